@@ -0,0 +1,1118 @@
+// Generated by https://honeythecodewitch.com/gfx/converter
+// --------------------------------------------------------
+// Add #define GALLERY_PHOTO_IMPLEMENTATION
+// to exactly one CPP file before including this file.
+// --------------------------------------------------------
+
+#ifndef GALLERY_PHOTO_HPP
+#define GALLERY_PHOTO_HPP
+#include <stdint.h>
+extern const uint8_t gallery_photo[];
+#endif
+
+#ifdef GALLERY_PHOTO_IMPLEMENTATION
+
+const uint8_t gallery_photo[] = {
+	0xff,0xd8,0xff,0xe0,0x00,0x10,0x4a,0x46,0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+	0x00,0x01,0x00,0x00,0xff,0xdb,0x00,0x43,0x00,0x06,0x04,0x05,0x06,0x05,0x04,0x06,
+	0x06,0x05,0x06,0x07,0x07,0x06,0x08,0x0a,0x10,0x0a,0x0a,0x09,0x09,0x0a,0x14,0x0e,
+	0x0f,0x0c,0x10,0x17,0x14,0x18,0x18,0x17,0x14,0x16,0x16,0x1a,0x1d,0x25,0x1f,0x1a,
+	0x1b,0x23,0x1c,0x16,0x16,0x20,0x2c,0x20,0x23,0x26,0x27,0x29,0x2a,0x29,0x19,0x1f,
+	0x2d,0x30,0x2d,0x28,0x30,0x25,0x28,0x29,0x28,0xff,0xdb,0x00,0x43,0x01,0x07,0x07,
+	0x07,0x0a,0x08,0x0a,0x13,0x0a,0x0a,0x13,0x28,0x1a,0x16,0x1a,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xff,0xc0,
+	0x00,0x11,0x08,0x01,0xe0,0x02,0x80,0x03,0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+	0x01,0xff,0xc4,0x00,0x1f,0x00,0x00,0x01,0x05,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,
+	0x0a,0x0b,0xff,0xc4,0x00,0xb5,0x10,0x00,0x02,0x01,0x03,0x03,0x02,0x04,0x03,0x05,
+	0x05,0x04,0x04,0x00,0x00,0x01,0x7d,0x01,0x02,0x03,0x00,0x04,0x11,0x05,0x12,0x21,
+	0x31,0x41,0x06,0x13,0x51,0x61,0x07,0x22,0x71,0x14,0x32,0x81,0x91,0xa1,0x08,0x23,
+	0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,0x24,0x33,0x62,0x72,0x82,0x09,0x0a,0x16,0x17,
+	0x18,0x19,0x1a,0x25,0x26,0x27,0x28,0x29,0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,
+	0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,
+	0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,
+	0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,
+	0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,
+	0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,
+	0xd6,0xd7,0xd8,0xd9,0xda,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,
+	0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xff,0xc4,0x00,0x1f,0x01,0x00,0x03,
+	0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+	0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0xff,0xc4,0x00,0xb5,0x11,0x00,
+	0x02,0x01,0x02,0x04,0x04,0x03,0x04,0x07,0x05,0x04,0x04,0x00,0x01,0x02,0x77,0x00,
+	0x01,0x02,0x03,0x11,0x04,0x05,0x21,0x31,0x06,0x12,0x41,0x51,0x07,0x61,0x71,0x13,
+	0x22,0x32,0x81,0x08,0x14,0x42,0x91,0xa1,0xb1,0xc1,0x09,0x23,0x33,0x52,0xf0,0x15,
+	0x62,0x72,0xd1,0x0a,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,0x27,
+	0x28,0x29,0x2a,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,
+	0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+	0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,0x88,
+	0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,
+	0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,
+	0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe2,
+	0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,
+	0xfa,0xff,0xda,0x00,0x0c,0x03,0x01,0x00,0x02,0x11,0x03,0x11,0x00,0x3f,0x00,0xe2,
+	0xb1,0x46,0x29,0xf8,0xa3,0x15,0xfa,0x35,0xcf,0x99,0x19,0x8a,0x31,0x4f,0xc5,0x18,
+	0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,
+	0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,
+	0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,
+	0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,
+	0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,
+	0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,
+	0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,
+	0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,
+	0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,
+	0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,
+	0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,
+	0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,
+	0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,
+	0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,
+	0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,
+	0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,
+	0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,
+	0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,
+	0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0f,0xc5,0x18,
+	0xa9,0x31,0x46,0x2b,0x3b,0x8c,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,
+	0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,
+	0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,
+	0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,
+	0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,
+	0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,
+	0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,
+	0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,
+	0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,
+	0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,
+	0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,
+	0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,
+	0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,
+	0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,
+	0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,
+	0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,
+	0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,
+	0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,
+	0x28,0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,
+	0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,
+	0x62,0x8b,0x80,0xfc,0x51,0x8a,0x7e,0x28,0xc5,0x65,0x71,0x8c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,
+	0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,
+	0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,
+	0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,
+	0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,
+	0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,
+	0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,
+	0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,
+	0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,
+	0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,
+	0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,
+	0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,
+	0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,
+	0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,
+	0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,
+	0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,
+	0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,
+	0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,
+	0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x09,0x31,
+	0x46,0x29,0xf8,0xa3,0x15,0x95,0xca,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,
+	0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,
+	0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,
+	0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,
+	0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,
+	0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,
+	0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,
+	0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,
+	0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,
+	0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,
+	0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,
+	0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,
+	0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,
+	0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,
+	0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x53,0xd9,0xd9,
+	0xcf,0x79,0x32,0xc5,0x6b,0x0b,0xcb,0x21,0xe8,0xa8,0xb9,0xad,0xef,0x09,0xf8,0x4e,
+	0xf7,0xc4,0x32,0x93,0x10,0x11,0xdb,0x21,0x1b,0xe5,0x61,0xc7,0xd0,0x7a,0x9a,0xf6,
+	0xbd,0x03,0x40,0xb0,0xd0,0xed,0xbc,0xab,0x28,0x40,0x63,0x8d,0xce,0x79,0x66,0x3f,
+	0x5a,0xf0,0xb3,0x4c,0xfe,0x8e,0x07,0xdc,0x8f,0xbd,0x3e,0xdd,0xbd,0x4e,0xfc,0x26,
+	0x5f,0x3c,0x47,0xbc,0xf4,0x89,0xe6,0x1a,0x37,0xc3,0x1d,0x42,0xe5,0x55,0xf5,0x09,
+	0x92,0xd9,0x08,0xce,0xd1,0xf3,0x30,0xae,0xba,0xc7,0xe1,0xae,0x89,0x6e,0xfb,0xa6,
+	0x13,0x5c,0x0c,0x63,0x6b,0xb7,0x19,0xf5,0xe2,0xbb,0x7a,0x2b,0xe2,0xf1,0x19,0xfe,
+	0x3a,0xbb,0xf8,0xf9,0x57,0x65,0xa7,0xfc,0x13,0xdb,0xa7,0x97,0xd0,0xa7,0xf6,0x6f,
+	0xea,0x72,0xdf,0xf0,0x80,0xf8,0x77,0xfe,0x7c,0x7f,0xf1,0xf3,0x59,0x97,0xff,0x00,
+	0x0c,0xb4,0x89,0xda,0x46,0xb7,0x79,0xa0,0x24,0x7c,0xaa,0x0e,0x55,0x4d,0x77,0x94,
+	0x57,0x34,0x33,0x6c,0x6d,0x37,0x78,0xd5,0x97,0xdf,0x7f,0xcc,0xd6,0x58,0x4a,0x12,
+	0x56,0x70,0x47,0x89,0x6b,0x7f,0x0d,0xf5,0x4b,0x14,0x79,0x2c,0xd9,0x2e,0xe2,0x5e,
+	0xcb,0xc3,0x63,0xe9,0x5c,0x54,0xf0,0x49,0x04,0x8d,0x1c,0xd1,0xb4,0x6e,0xa7,0x05,
+	0x58,0x60,0x8a,0xfa,0x8a,0xb9,0xff,0x00,0x14,0x78,0x56,0xc3,0x5e,0x81,0xbc,0xd8,
+	0xc2,0x5c,0x85,0xc2,0x4a,0xa3,0x91,0xf5,0xf5,0xaf,0xa1,0xcb,0xf8,0xaa,0xa2,0x6a,
+	0x18,0xb5,0x75,0xdd,0x6f,0xf7,0x1e,0x76,0x23,0x29,0x8b,0x57,0xa2,0xf5,0xec,0x7c,
+	0xf3,0x8a,0x31,0x5b,0x7e,0x24,0xf0,0xf5,0xee,0x81,0x76,0x21,0xbc,0x5c,0xab,0x72,
+	0x92,0x2f,0xdd,0x6a,0xc7,0xc5,0x7d,0xad,0x2a,0xd0,0xad,0x05,0x52,0x9b,0xba,0x67,
+	0x87,0x38,0x4a,0x0f,0x96,0x4a,0xcc,0x66,0x28,0xc5,0x3f,0x14,0x62,0xb4,0xb9,0x23,
+	0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,
+	0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x3f,
+	0x14,0x62,0xa4,0xc5,0x18,0xac,0xee,0x32,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,
+	0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,
+	0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,
+	0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,
+	0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,
+	0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,
+	0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,
+	0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,
+	0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,
+	0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,
+	0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,
+	0x28,0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,
+	0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,
+	0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,
+	0x18,0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x6a,0xf8,0x6b,
+	0x45,0x9b,0x5c,0xd5,0x62,0xb4,0x8b,0x2a,0xa7,0x97,0x7c,0x64,0x28,0xac,0xec,0x57,
+	0xb5,0xfc,0x32,0xd1,0x46,0x9b,0xa2,0x0b,0x99,0x17,0xf7,0xf7,0x5f,0x39,0xf6,0x5e,
+	0xd5,0xe5,0x67,0x19,0x8f,0xd4,0x70,0xee,0x71,0xf8,0x9e,0x8b,0xd7,0xfe,0x01,0xd7,
+	0x82,0xc3,0x7d,0x62,0xaa,0x8b,0xd9,0x6e,0x74,0xda,0x55,0x84,0x3a,0x65,0x84,0x36,
+	0x96,0xea,0x04,0x71,0xa8,0x1d,0x3a,0xfb,0x9a,0xb7,0x45,0x15,0xf9,0x84,0xa4,0xe7,
+	0x27,0x29,0x3d,0x59,0xf5,0x69,0x28,0xab,0x20,0xa2,0x8a,0x2a,0x46,0x14,0x51,0x45,
+	0x00,0x14,0x51,0x45,0x00,0x65,0x78,0x97,0x46,0x87,0x5c,0xd2,0xa5,0xb4,0x9b,0x0a,
+	0xc7,0x94,0x7c,0x64,0xa9,0xf5,0xaf,0x9f,0xf5,0x5d,0x3e,0x6d,0x36,0xfe,0x6b,0x4b,
+	0x85,0x21,0xe3,0x62,0x3e,0xbe,0xe2,0xbe,0x95,0xaf,0x3a,0xf8,0xb5,0xa2,0x89,0xad,
+	0x23,0xd5,0x22,0x5f,0x9e,0x2f,0x92,0x4f,0x75,0xed,0xfe,0x7d,0xeb,0xe9,0xb8,0x73,
+	0x32,0x74,0x2a,0xfd,0x5a,0x6f,0xdd,0x96,0xde,0x4f,0xfe,0x09,0xe5,0x66,0x78,0x55,
+	0x52,0x1e,0xd6,0x3b,0xaf,0xc8,0xf2,0x4c,0x51,0x8a,0x93,0x14,0x62,0xbf,0x40,0xb9,
+	0xf3,0xa4,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,
+	0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,
+	0xa2,0xe0,0x3f,0x14,0x62,0x9f,0x8a,0x31,0x59,0x5c,0xab,0x0c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,
+	0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,
+	0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,
+	0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,
+	0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,
+	0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,
+	0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,
+	0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,
+	0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,
+	0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,
+	0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,
+	0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,0xcc,
+	0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0xb0,
+	0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,
+	0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x16,0x74,0x8b,0x51,0x77,0xa9,0xda,
+	0xdb,0x93,0xb4,0x49,0x20,0x5c,0xe3,0xa7,0x35,0xf4,0x4d,0xbc,0x4b,0x04,0x11,0xc4,
+	0x80,0x05,0x45,0x0a,0x00,0xe9,0x5e,0x21,0xf0,0xf6,0x24,0x93,0xc5,0x76,0x42,0x45,
+	0x0c,0x01,0x27,0x04,0x77,0xc5,0x7b,0x9d,0x7c,0x47,0x15,0x56,0x72,0xad,0x0a,0x7d,
+	0x12,0xbf,0xdf,0xff,0x00,0x0c,0x7b,0xd9,0x44,0x12,0x84,0xa5,0xe6,0x14,0x51,0x45,
+	0x7c,0xa9,0xeb,0x85,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,
+	0x51,0xd7,0x2c,0xd2,0xff,0x00,0x49,0xba,0xb6,0x93,0x18,0x78,0xc8,0xc9,0x19,0xc1,
+	0xf5,0xab,0xd4,0x10,0x08,0x20,0xf4,0x35,0x50,0x9b,0x84,0x94,0x96,0xe8,0x99,0x25,
+	0x24,0xd3,0x3e,0x69,0x95,0x36,0x48,0xe9,0xfd,0xd2,0x45,0x33,0x15,0xa9,0xe2,0x28,
+	0xd6,0x3d,0x76,0xf9,0x11,0x42,0xa8,0x99,0x80,0x00,0x74,0xe6,0xb3,0xb1,0x5f,0xae,
+	0x53,0xa9,0xcf,0x05,0x2e,0xe8,0xf8,0xd9,0x47,0x96,0x4d,0x0c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x55,0xdc,0x56,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,
+	0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x62,0x4c,0x51,
+	0x8a,0x7e,0x28,0xc5,0x65,0x71,0x8c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,
+	0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,
+	0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,
+	0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,
+	0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,
+	0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,
+	0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,
+	0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,
+	0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,
+	0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,
+	0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,
+	0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,
+	0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,
+	0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,
+	0x62,0x8b,0x81,0xbb,0xe0,0x39,0xa3,0xb7,0xf1,0x4d,0x93,0xca,0x76,0xa9,0x25,0x7f,
+	0x12,0x38,0xaf,0x72,0xaf,0x9e,0x74,0xe9,0xcd,0xa5,0xfd,0xbd,0xc2,0xe3,0x31,0xb8,
+	0x6e,0x7a,0x57,0xd0,0x16,0x73,0xad,0xcd,0xac,0x33,0xc6,0x72,0xb2,0x28,0x60,0x7e,
+	0xb5,0xf1,0x7c,0x51,0x49,0xaa,0xb0,0xab,0xd1,0xab,0x7d,0xdf,0xf0,0xe7,0xbb,0x94,
+	0xcd,0x72,0x4a,0x04,0xd4,0x51,0x45,0x7c,0xb9,0xeb,0x85,0x14,0x51,0x40,0x05,0x14,
+	0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x23,0x30,0x55,0x2c,0x7a,0x01,0x93,0x4b,0x59,
+	0xde,0x21,0xbd,0x5d,0x3f,0x46,0xba,0xb9,0x62,0x06,0xd4,0x38,0xcf,0xa9,0xe9,0x57,
+	0x4e,0x0e,0xa4,0xd4,0x16,0xec,0x99,0x49,0x45,0x39,0x3e,0x87,0x86,0xeb,0xd2,0x24,
+	0xfa,0xd5,0xec,0xb1,0x1c,0xa3,0xca,0xc4,0x1f,0x5e,0x6a,0x86,0x2a,0x57,0x25,0xdd,
+	0x98,0xf5,0x27,0x34,0xdc,0x57,0xea,0xf4,0xd7,0x24,0x54,0x7b,0x1f,0x1d,0x27,0xcc,
+	0xdb,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xaa,0xb8,0x86,0x62,0x8c,0x53,0xf1,0x46,0x28,
+	0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,
+	0xe0,0x3f,0x14,0x62,0xa4,0xc5,0x18,0xac,0xf9,0x86,0x47,0x8a,0x31,0x52,0x62,0x8c,
+	0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,0x8a,0x31,0x52,0x62,
+	0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,0x8a,0x31,0x52,
+	0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,0x8a,0x31,
+	0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,0x8a,
+	0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,
+	0x8a,0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,
+	0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,
+	0xc0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,
+	0x1c,0xc0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,
+	0xc5,0x1c,0xc0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,
+	0x2a,0xd6,0x99,0x63,0x2e,0xa3,0x7f,0x0d,0xac,0x00,0x97,0x95,0x82,0x8e,0x3a,0x7b,
+	0xd2,0x73,0x49,0x5d,0x8d,0x26,0xdd,0x91,0x4b,0x69,0xc6,0x71,0xc5,0x26,0x2b,0xdd,
+	0x6c,0xfc,0x17,0xa6,0xc3,0xa1,0x36,0x9f,0x24,0x61,0xd9,0xc6,0x5e,0x5c,0x7c,0xdb,
+	0xbd,0x47,0xa5,0x79,0x3f,0x89,0xfc,0x3f,0x75,0xa0,0xdf,0x18,0x67,0x05,0xa2,0x3c,
+	0xc7,0x20,0x1c,0x30,0xac,0x69,0x62,0x63,0x51,0xb4,0x8d,0xaa,0x50,0x95,0x35,0x76,
+	0x61,0x62,0x8c,0x54,0x98,0xa3,0x15,0xbf,0x31,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,
+	0x47,0x30,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x73,0x01,0x1e,0x28,0xc5,0x49,0x8a,
+	0x31,0x47,0x30,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x73,0x01,0x1e,0x28,0xc5,0x49,
+	0x8a,0x31,0x47,0x30,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x73,0x01,0x1e,0x2b,0xd6,
+	0x3e,0x1a,0x6b,0x02,0xef,0x4d,0x36,0x33,0x3f,0xef,0xa0,0xfb,0xb9,0x3c,0x95,0xff,
+	0x00,0x3f,0xd2,0xbc,0xaf,0x15,0x73,0x49,0xbf,0x9b,0x4c,0xbf,0x8a,0xea,0xdc,0xe1,
+	0xd0,0xf4,0x3d,0x08,0xf4,0xaf,0x3f,0x33,0xc1,0xac,0x6d,0x07,0x4f,0xae,0xeb,0xd4,
+	0xe9,0xc2,0x57,0x74,0x2a,0x29,0x74,0xea,0x7b,0xe5,0x15,0x43,0x43,0xd4,0xe1,0xd5,
+	0x74,0xf8,0xae,0x61,0x65,0x24,0x8f,0x99,0x41,0xfb,0xa7,0xb8,0xab,0xf5,0xf9,0xcc,
+	0xe1,0x2a,0x72,0x70,0x92,0xb3,0x47,0xd4,0x46,0x4a,0x4b,0x99,0x6c,0x14,0x51,0x45,
+	0x49,0x41,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x5e,0x73,0xf1,0x47,0x58,0xc8,
+	0x8f,0x4d,0x81,0xf3,0xfc,0x72,0xe0,0xfe,0x43,0xfc,0xfb,0x57,0x59,0xe2,0xad,0x6e,
+	0x3d,0x17,0x4d,0x79,0x01,0x53,0x70,0xdc,0x46,0x84,0xf5,0x35,0xe2,0xd7,0x73,0xc9,
+	0x75,0x73,0x24,0xf3,0x36,0xe9,0x24,0x62,0xcc,0x7d,0xeb,0xe9,0x32,0x0c,0xbd,0xd4,
+	0xa9,0xf5,0x99,0xad,0x16,0xde,0x6f,0xfe,0x01,0xe5,0x66,0x58,0x95,0x18,0xfb,0x28,
+	0xee,0xf7,0x2b,0x62,0x8c,0x54,0x98,0xa3,0x15,0xf6,0x9c,0xc7,0x82,0x47,0x8a,0x31,
+	0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x47,0x8a,
+	0x31,0x52,0x62,0x8c,0x51,0xcc,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x1c,0xc0,0x3f,
+	0x14,0x62,0xa4,0xc5,0x18,0xac,0xae,0x51,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,
+	0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,
+	0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,
+	0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,
+	0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,
+	0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,
+	0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,
+	0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,
+	0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,
+	0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x9d,
+	0x1c,0x6d,0x23,0xaa,0x22,0x96,0x66,0x38,0x00,0x77,0x34,0x73,0x58,0x12,0xb8,0xeb,
+	0x0b,0x29,0xef,0xee,0xa3,0xb7,0xb5,0x8c,0xc9,0x2b,0x9c,0x00,0x2b,0xda,0xbc,0x1d,
+	0xe1,0x7b,0x7d,0x06,0xd4,0x3b,0x85,0x92,0xf5,0xc7,0xcf,0x27,0xa7,0xb0,0xf6,0xaa,
+	0x1e,0x00,0xd0,0x62,0xd1,0x6d,0x5a,0xe2,0xee,0x68,0x4d,0xdc,0xc0,0x64,0x6e,0x1f,
+	0x20,0xf4,0xcd,0x74,0x12,0x78,0x83,0x48,0x8a,0x46,0x49,0x35,0x1b,0x55,0x75,0x38,
+	0x20,0xc8,0x38,0x35,0xe7,0x62,0x2b,0xb9,0xfb,0xb1,0xd8,0xf4,0x68,0x50,0xe4,0xf7,
+	0x9e,0xe6,0xa5,0x67,0xeb,0x5a,0x55,0xb6,0xb1,0x62,0xf6,0xd7,0x68,0x19,0x4f,0x43,
+	0xdd,0x4f,0xa8,0xac,0xeb,0xef,0x19,0x68,0x36,0x5b,0x7c,0xdd,0x42,0x26,0xdd,0xd3,
+	0xcb,0xf9,0xbf,0x95,0x67,0x5d,0x7c,0x46,0xf0,0xf4,0x30,0x33,0xc7,0x72,0xf3,0x30,
+	0xe8,0x88,0x87,0x26,0xb9,0x95,0xd3,0xba,0x3a,0x5a,0xba,0xb3,0x3c,0xcf,0xc4,0xda,
+	0x05,0xce,0x85,0x7c,0x61,0x9d,0x4b,0x44,0x79,0x8e,0x40,0x38,0x61,0x58,0xd8,0xaf,
+	0x46,0xd6,0xbe,0x20,0xf8,0x77,0x57,0xb1,0x7b,0x6b,0xbb,0x4b,0xa6,0x53,0xd0,0xed,
+	0x19,0x53,0xea,0x2b,0xcf,0x4b,0xc5,0x23,0x31,0xb7,0x62,0xd1,0xe7,0xe5,0x27,0x83,
+	0x8f,0x7a,0xf4,0xe8,0x57,0xe7,0x56,0x7b,0x9e,0x6d,0x7a,0x0e,0x9b,0xba,0xd8,0x8f,
+	0x14,0x62,0xa4,0xc5,0x18,0xad,0xee,0x73,0x91,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,
+	0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,
+	0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,
+	0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x5e,0xd1,0x75,0x8b,0xcd,0x1e,0x7f,
+	0x32,0xd2,0x4c,0x03,0x8d,0xc8,0x79,0x0c,0x2b,0xd5,0x7c,0x3f,0xe2,0x6b,0x2d,0x5e,
+	0x30,0x03,0x88,0xae,0x07,0x06,0x37,0x3d,0x4f,0xb7,0xad,0x78,0xe6,0x29,0x54,0xb2,
+	0x30,0x2a,0x48,0x23,0xb8,0xaf,0x33,0x1f,0x95,0xd1,0xc6,0xab,0xbd,0x25,0xdf,0xfc,
+	0xce,0xbc,0x36,0x32,0x74,0x34,0x5a,0xae,0xc7,0xd0,0x14,0x57,0x90,0xe9,0x9e,0x2f,
+	0xd5,0x6c,0x42,0xa9,0x94,0x4f,0x18,0x18,0xc4,0x9c,0xfe,0xb5,0xd2,0x5a,0x7c,0x41,
+	0x85,0x9f,0x17,0x56,0x8e,0x8b,0x8e,0xa8,0xd9,0xe6,0xbe,0x5e,0xb6,0x47,0x8a,0xa6,
+	0xfd,0xd5,0xcc,0xbc,0x8f,0x5e,0x9e,0x63,0x46,0x7b,0xbb,0x1d,0xd5,0x15,0xc7,0xff,
+	0x00,0xc2,0x7d,0xa6,0xff,0x00,0xcf,0x1b,0x8f,0xc8,0x55,0x1b,0xcf,0x88,0x2a,0x19,
+	0xc5,0xa5,0x99,0x23,0x1f,0x2b,0x3b,0x77,0xf7,0x15,0x84,0x32,0x9c,0x64,0x9d,0xb9,
+	0x0d,0x25,0x8d,0xa0,0x95,0xf9,0x8e,0xf8,0x90,0x06,0x49,0xc0,0xae,0x5f,0xc4,0xbe,
+	0x2e,0xb4,0xd3,0x11,0xa2,0xb6,0x61,0x3d,0xd1,0x07,0x01,0x4e,0x42,0x9f,0x7a,0xe0,
+	0xf5,0x5f,0x14,0x6a,0x9a,0x88,0x64,0x92,0x6f,0x2e,0x26,0xfe,0x08,0xf8,0x15,0x84,
+	0x72,0x4e,0x4e,0x49,0xaf,0x6b,0x07,0xc3,0xea,0x2d,0x4b,0x12,0xef,0xe4,0xbf,0xcc,
+	0xe1,0xaf,0x99,0xdd,0x5a,0x92,0xf9,0x96,0x35,0x3d,0x42,0xe7,0x53,0xb9,0x33,0xde,
+	0x4a,0x64,0x73,0xc7,0x3d,0x00,0xaa,0x78,0xa9,0x31,0x46,0x2b,0xe9,0xa2,0x94,0x12,
+	0x8c,0x55,0x92,0x3c,0x86,0xdc,0x9d,0xd9,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x55,0x71,
+	0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,
+	0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,
+	0x80,0xfc,0x51,0x8a,0x7e,0x28,0xc5,0x67,0x71,0xd8,0x66,0x28,0xc5,0x3f,0x14,0x62,
+	0x8b,0x85,0x86,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x58,0x66,0x28,0xc5,0x3f,0x14,
+	0x62,0x8b,0x85,0x86,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x58,0x66,0x28,0xc5,0x3f,
+	0x14,0x62,0x8b,0x85,0x86,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x58,0x66,0x28,0xc5,
+	0x3f,0x14,0x62,0x8b,0x85,0x86,0x62,0xae,0x5b,0xe9,0x77,0xb7,0x16,0x8f,0x73,0x05,
+	0xbc,0x8f,0x02,0x1c,0x33,0x28,0xe9,0x5b,0x3e,0x11,0xf0,0xcc,0xda,0xe5,0xd0,0x67,
+	0x05,0x2d,0x10,0xfc,0xef,0x8e,0xbe,0xc2,0xbd,0x8a,0xca,0xce,0x0b,0x2b,0x44,0xb6,
+	0xb7,0x8d,0x52,0x24,0x18,0x0a,0x05,0x61,0x56,0xbf,0x26,0x88,0xe8,0xa5,0x41,0xcf,
+	0x57,0xb1,0xf3,0xc1,0x52,0x0e,0x0e,0x41,0xa3,0x15,0xed,0x9a,0xef,0x83,0xf4,0xdd,
+	0x54,0x33,0x88,0xc4,0x13,0x9f,0xe3,0x41,0x8c,0x9f,0x71,0x5e,0x73,0xae,0xf8,0x3f,
+	0x51,0xd2,0xcb,0x38,0x8f,0xcf,0x80,0x7f,0x1a,0x0c,0xe0,0x7b,0x8a,0x70,0xaf,0x19,
+	0x13,0x3a,0x12,0x81,0xcc,0xe2,0x8c,0x53,0xca,0x90,0x70,0x46,0x0d,0x18,0xad,0x6e,
+	0x63,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x77,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,
+	0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,0xa7,
+	0xe2,0x8c,0x51,0x70,0xb0,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x0b,0x0c,0xc5,0x18,
+	0xa7,0xe2,0x91,0xb0,0xa0,0x93,0xc0,0x14,0xae,0x16,0x18,0xd8,0x50,0x49,0x38,0x02,
+	0xb3,0x2e,0x2f,0x1f,0xcd,0xcc,0x0e,0xc8,0x06,0x46,0x41,0xc6,0x69,0x2f,0x6e,0x8c,
+	0xa4,0xa2,0x70,0x83,0xf5,0xaa,0x95,0xcb,0x56,0xaf,0x37,0xba,0x8f,0x43,0x0f,0x43,
+	0x97,0xde,0x96,0xe4,0xbf,0x68,0x9f,0xfe,0x7b,0x49,0xff,0x00,0x7d,0x1a,0x88,0x92,
+	0x4e,0x49,0x24,0xfa,0x9a,0x28,0xae,0x73,0xac,0x28,0xa2,0x8a,0x00,0x2a,0x6b,0x59,
+	0xcc,0x32,0x67,0xaa,0x9e,0xa2,0xa1,0xa2,0x9a,0x6e,0x2e,0xe8,0x52,0x8a,0x92,0xb3,
+	0x37,0x91,0x83,0xa8,0x65,0x39,0x06,0x9d,0x8a,0xc7,0xb4,0xb9,0x30,0x36,0x0f,0x28,
+	0x7a,0x8a,0xd9,0x8d,0x96,0x44,0x0c,0xa7,0x20,0xd7,0x75,0x3a,0xaa,0x68,0xf2,0xeb,
+	0x51,0x74,0xdf,0x90,0x98,0xa3,0x14,0xfc,0x51,0x8a,0xd2,0xe6,0x36,0x19,0x8a,0x31,
+	0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,
+	0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,
+	0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,
+	0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,
+	0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,
+	0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,
+	0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,0x98,0xa3,0x14,0xfc,
+	0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x62,0x4c,0x51,0x8a,
+	0x7e,0x28,0xc5,0x65,0x71,0x8c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,
+	0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,
+	0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,
+	0xfc,0x51,0x8a,0x2e,0x03,0x31,0x5d,0x07,0x84,0xfc,0x35,0x36,0xb7,0x72,0x19,0x81,
+	0x4b,0x44,0x3f,0x3b,0xfa,0xfb,0x0a,0xe6,0xef,0x2e,0x52,0xd2,0x06,0x95,0xc8,0xe3,
+	0xa0,0x3d,0xcf,0xa5,0x64,0xdc,0x78,0xd7,0x5b,0x92,0xd9,0x6d,0xa1,0xbb,0x6b,0x6b,
+	0x75,0x39,0x54,0x84,0x6d,0xc7,0xe3,0xd6,0xb2,0xa9,0x51,0xa5,0x64,0x74,0x51,0xa5,
+	0xce,0xee,0xf6,0x3e,0x8f,0x17,0x3a,0x56,0x87,0x67,0x1c,0x4d,0x71,0x6f,0x6d,0x02,
+	0x7c,0xa3,0x73,0x81,0xcf,0xf8,0xd7,0x37,0xaa,0xfc,0x4e,0xf0,0xed,0x86,0xe0,0x93,
+	0xbd,0xcb,0xab,0x6d,0x2b,0x12,0xfe,0xb9,0xf4,0xaf,0x9d,0xae,0x2e,0xa7,0xb9,0x76,
+	0x7b,0x89,0xa4,0x91,0x98,0xe4,0x96,0x62,0x72,0x6a,0x1a,0xe5,0xe5,0xee,0x77,0xec,
+	0x7a,0xee,0xab,0xf1,0x92,0x76,0xca,0xe9,0x9a,0x7a,0x26,0x1b,0x87,0x94,0xe7,0x2b,
+	0xf4,0xf5,0xaa,0x7f,0xf0,0x9b,0xea,0x7a,0xd4,0x04,0xfd,0xa8,0xc6,0x33,0x92,0x89,
+	0xc6,0xdf,0x6f,0xa5,0x79,0x75,0x5a,0xd3,0xef,0x64,0xb2,0x98,0x3a,0x72,0xa7,0xef,
+	0x2f,0xad,0x69,0x0b,0x45,0xea,0x67,0x56,0x2e,0x51,0xd1,0x9d,0xab,0xb3,0x48,0xe5,
+	0xdc,0xe5,0x89,0xc9,0x27,0xbd,0x26,0x29,0x96,0xb3,0xa5,0xcc,0x0b,0x2c,0x67,0xe5,
+	0x6a,0x9b,0x15,0xd5,0xcc,0x79,0xad,0x5b,0x71,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x77,
+	0x10,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,
+	0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,
+	0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x1d,0x28,0xb8,
+	0xc8,0xf1,0x8a,0xc8,0xd4,0xae,0x84,0x8d,0xe5,0xc6,0x7e,0x51,0xd4,0xfa,0xd3,0xf5,
+	0x1b,0xed,0xc4,0xc5,0x09,0xf9,0x7b,0x9f,0x5a,0xcd,0xac,0x2a,0x54,0xbe,0x88,0xed,
+	0xc3,0xd0,0xb7,0xbd,0x20,0xa2,0x8a,0x2b,0x03,0xb0,0x28,0xa2,0x8a,0x00,0x28,0xa2,
+	0x8a,0x00,0x28,0xa2,0x8a,0x00,0x2a,0xdd,0x85,0xcf,0x91,0x26,0x1c,0x9d,0x87,0xf4,
+	0xaa,0x94,0x53,0x4d,0xa7,0x74,0x4c,0xa2,0xa4,0xac,0xce,0x99,0x70,0xc0,0x15,0x20,
+	0x83,0x4b,0x8a,0xc5,0xd3,0xef,0x4c,0x2c,0x12,0x43,0x98,0xcf,0xe9,0x5b,0x8a,0x43,
+	0x28,0x2a,0x72,0x0d,0x75,0xc6,0xa7,0x32,0x3c,0xca,0xb4,0x9d,0x37,0x66,0x37,0x14,
+	0x62,0x9f,0x8a,0x31,0x55,0x73,0x21,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,
+	0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,
+	0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,
+	0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,
+	0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,
+	0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,
+	0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,
+	0x9f,0x8a,0x31,0x45,0xc0,0x7e,0x28,0xc5,0x3f,0x14,0x62,0xb2,0xb9,0x43,0x31,0x46,
+	0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,
+	0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,
+	0x9f,0x8a,0x31,0x45,0xc0,0x66,0x2a,0x0b,0xcb,0x98,0xed,0x21,0x32,0x4a,0x70,0x07,
+	0x41,0xeb,0x53,0x4f,0x2a,0x41,0x13,0x49,0x2b,0x05,0x51,0xd4,0x9a,0xe2,0x75,0x4b,
+	0xe7,0xbd,0xb8,0x66,0x24,0xf9,0x60,0xfc,0xa3,0xd0,0x54,0xca,0x76,0x35,0xa5,0x4b,
+	0x9d,0xf9,0x0d,0xd4,0x6f,0xa4,0xbd,0x98,0xb3,0x9c,0x28,0xfb,0xab,0xe9,0x55,0x28,
+	0xa2,0xb2,0x6e,0xe7,0x7a,0x49,0x2b,0x20,0xa2,0x8a,0x29,0x0c,0x28,0xa2,0x8a,0x00,
+	0xd1,0xd2,0x35,0x17,0xb2,0x94,0x03,0x96,0x89,0x8f,0x2b,0xfd,0x6b,0xb1,0x8d,0x96,
+	0x44,0x0c,0xa7,0x20,0x8c,0x82,0x2b,0xcf,0x6b,0x6b,0x40,0xd4,0xda,0x09,0x56,0x09,
+	0x9b,0xf7,0x2d,0xd0,0x9f,0xe1,0xad,0x23,0x2b,0x68,0x73,0x56,0xa5,0xcd,0xef,0x23,
+	0xaa,0xc5,0x18,0xa7,0x80,0x08,0xc8,0xe9,0x46,0x2b,0x4b,0x9c,0x63,0x31,0x46,0x29,
+	0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,
+	0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,
+	0x8a,0x31,0x45,0xc0,0x66,0x2b,0x23,0x56,0xbc,0xff,0x00,0x96,0x31,0x37,0xfb,0xc4,
+	0x54,0xba,0xa5,0xfe,0xcc,0xc5,0x09,0xf9,0xbb,0xb0,0xed,0x58,0x87,0x93,0xcd,0x67,
+	0x39,0xf4,0x47,0x5d,0x0a,0x1f,0x6a,0x41,0x45,0x14,0x56,0x47,0x68,0x51,0x45,0x14,
+	0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,
+	0x00,0x56,0x8e,0x95,0x79,0xe5,0x3f,0x97,0x2b,0x7c,0x87,0xa6,0x7b,0x56,0x75,0x14,
+	0xd3,0xb3,0xb9,0x33,0x82,0x9a,0xb3,0x3a,0xd0,0x01,0x1c,0x51,0x8a,0xc7,0xd2,0xef,
+	0xf6,0x11,0x14,0xc7,0xe5,0xec,0xc7,0xb5,0x6d,0x81,0x91,0xc5,0x6e,0xa5,0x73,0xcc,
+	0xa9,0x4d,0xc1,0xd9,0x8c,0xc5,0x18,0xa7,0xe2,0x8c,0x53,0xb9,0x03,0x31,0x46,0x29,
+	0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,
+	0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,
+	0x8a,0x31,0x45,0xc0,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,
+	0x28,0xc5,0x17,0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,
+	0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,
+	0x31,0x45,0xc0,0x93,0x14,0x62,0x9f,0x8a,0x31,0x59,0xdc,0x63,0x31,0x46,0x29,0xf8,
+	0xa3,0x14,0x5c,0x06,0x62,0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,
+	0x8c,0x51,0x70,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x15,0x1d,0xc4,0xb1,
+	0xdb,0xc4,0xd2,0x4a,0xc1,0x55,0x46,0x49,0x35,0x2c,0x8c,0xb1,0xa1,0x67,0x20,0x28,
+	0x19,0x24,0xd7,0x13,0xaf,0xea,0x7f,0x6d,0x9f,0x64,0x44,0xf9,0x0b,0xd0,0x7a,0x9f,
+	0x5a,0x5c,0xc6,0x94,0xe9,0xb9,0xb2,0x3d,0x63,0x53,0x7b,0xf9,0x70,0x32,0xb0,0xaf,
+	0xdd,0x5f,0xea,0x6b,0x36,0x8a,0x2a,0x4e,0xf8,0xc5,0x45,0x59,0x05,0x14,0x51,0x48,
+	0x61,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x07,0x4b,0xe1,0xbd,
+	0x53,0xfe,0x5d,0xae,0x5f,0xfd,0xc2,0x7f,0x95,0x74,0xd8,0xaf,0x34,0x04,0x83,0x91,
+	0xd6,0xbb,0x1f,0x0e,0xea,0xab,0x73,0x12,0xdb,0xcc,0xdf,0xbf,0x5e,0x84,0xff,0x00,
+	0x10,0xaa,0x4c,0xe4,0xad,0x4b,0xed,0x23,0x6b,0x14,0x62,0x9f,0x8a,0x31,0x55,0x73,
+	0x98,0x66,0x28,0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,
+	0x01,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x59,0x5a,0xc5,0xf7,0x92,0xbe,
+	0x54,0x2c,0x37,0x9e,0xa4,0x76,0xa9,0x75,0x5d,0x40,0x5b,0x29,0x8e,0x22,0x0c,0xa7,
+	0xf4,0xae,0x71,0x98,0xbb,0x16,0x62,0x49,0x3d,0x49,0xa9,0x72,0x3a,0xa8,0x51,0xbf,
+	0xbd,0x21,0x09,0xc9,0xe6,0x8a,0x28,0xa8,0x3b,0x42,0x8a,0x28,0xa0,0x02,0x8a,0x28,
+	0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,0x28,
+	0xa0,0x02,0x8a,0x28,0xa0,0x02,0xb6,0x74,0x6b,0xe3,0xb8,0x41,0x33,0x0c,0x7f,0x09,
+	0x3f,0xca,0xb1,0xa8,0x07,0x07,0x8a,0x69,0xd8,0x89,0xc1,0x4d,0x59,0x9d,0xa6,0x28,
+	0xc5,0x65,0x69,0x1a,0x97,0x99,0x88,0x67,0x3f,0x37,0x45,0x63,0xde,0xb6,0x31,0x57,
+	0xcc,0x79,0xd3,0x83,0x83,0xb3,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa7,0x72,0x06,0x62,
+	0x8c,0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,
+	0x31,0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x66,0x28,
+	0xc5,0x3f,0x14,0x62,0x8b,0x80,0xcc,0x51,0x8a,0x7e,0x28,0xc5,0x17,0x01,0x98,0xa3,
+	0x14,0xfc,0x51,0x8a,0x2e,0x03,0x31,0x46,0x29,0xf8,0xa3,0x14,0x5c,0x06,0x62,0x8c,
+	0x53,0xf1,0x46,0x28,0xb8,0x0c,0xc5,0x18,0xa7,0xe2,0x8c,0x51,0x70,0x19,0x8a,0x31,
+	0x4f,0xc5,0x18,0xa2,0xe0,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc0,0x7e,0x28,0xc5,
+	0x49,0x8a,0x31,0x59,0x5c,0x64,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,
+	0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,
+	0xd9,0x19,0x63,0x42,0xee,0x42,0xa8,0x19,0x24,0xd4,0xc7,0x00,0x64,0xf0,0x2b,0x8d,
+	0xf1,0x3e,0xb0,0xb7,0x04,0xda,0xdb,0x1c,0xc6,0xa7,0xe6,0x60,0x7a,0xd0,0x99,0x70,
+	0x83,0x9b,0xb1,0x5f,0x5f,0xd6,0x1a,0xf1,0xcc,0x30,0x12,0x20,0x07,0xfe,0xfa,0xac,
+	0x4a,0x28,0xa6,0x77,0x46,0x2a,0x2a,0xc8,0x28,0xa2,0x8a,0x0a,0x0a,0x28,0xa2,0x80,
+	0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x74,0x6e,0xd1,
+	0xc8,0xae,0x84,0x86,0x53,0x90,0x45,0x36,0x8a,0x00,0xef,0x74,0x4d,0x52,0x3d,0x42,
+	0x10,0x09,0x0b,0x32,0x8f,0x99,0x7f,0xa8,0xad,0x4c,0x57,0x9a,0xd9,0x5d,0x49,0x67,
+	0x72,0x93,0x44,0x7e,0x65,0x3f,0x9d,0x7a,0x06,0x93,0xa8,0x45,0xa8,0xdb,0x89,0x23,
+	0xe1,0x87,0xde,0x5f,0x43,0x43,0x67,0x15,0x5a,0x5c,0xae,0xeb,0x62,0xd6,0x28,0xc5,
+	0x49,0x8a,0x31,0x4a,0xe6,0x24,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x56,
+	0x6e,0xb1,0x7d,0xf6,0x48,0xc2,0x47,0xcc,0xad,0xfa,0x54,0xfa,0xae,0xa0,0x96,0x51,
+	0xe0,0x73,0x29,0xe8,0x2b,0x93,0x9a,0x57,0x9a,0x46,0x79,0x09,0x2c,0x68,0xb9,0xd1,
+	0x46,0x8f,0x37,0xbc,0xf6,0x1a,0xec,0x5d,0x8b,0x31,0x24,0x9e,0xa4,0xd2,0x51,0x45,
+	0x07,0x70,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,
+	0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,0x14,0x00,0x51,0x45,
+	0x14,0x00,0x51,0x45,0x14,0x00,0x03,0x83,0x91,0x5d,0x16,0x89,0xa8,0x19,0xbf,0x71,
+	0x31,0xf9,0xc0,0xe0,0xfa,0xd7,0x3b,0x4a,0x8c,0x51,0x83,0x29,0x20,0x8e,0x41,0x14,
+	0x11,0x52,0x0a,0x6a,0xcc,0xee,0x71,0x46,0x2b,0x3b,0x47,0xd4,0x96,0xe9,0x44,0x52,
+	0x9c,0x4c,0x3f,0xf1,0xea,0xd5,0xc5,0x17,0x3c,0xe9,0x41,0xc5,0xd9,0x91,0xe2,0x8c,
+	0x54,0x98,0xa3,0x14,0x5c,0x92,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,
+	0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,
+	0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,
+	0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,
+	0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,
+	0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x49,
+	0x8a,0x31,0x4e,0xc5,0x18,0xac,0xae,0x50,0xdc,0x51,0x8a,0x76,0x28,0xc5,0x17,0x01,
+	0xb8,0xa3,0x14,0xec,0x51,0x8a,0x2e,0x03,0x71,0x48,0x70,0x06,0x4f,0x02,0x9f,0x8a,
+	0xe5,0xbc,0x51,0xae,0x2c,0x6a,0xf6,0x76,0xa4,0x17,0x3c,0x3b,0x7a,0x7b,0x53,0x5a,
+	0x95,0x18,0x39,0x3b,0x22,0xa7,0x89,0x75,0xdf,0x34,0xb5,0xad,0x9b,0x7e,0xef,0xa3,
+	0xb8,0xef,0xec,0x2b,0x98,0xa2,0x8a,0xd5,0x2b,0x1d,0xb1,0x8a,0x8a,0xb2,0x0a,0x28,
+	0xa2,0x82,0x82,0x8a,0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,
+	0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0x8a,0x28,0xa0,0x02,0xaf,0x69,0x3a,0x8c,0xba,
+	0x75,0xc8,0x92,0x3e,0x50,0xfd,0xe5,0xf5,0x15,0x46,0x8a,0x04,0xd5,0xf4,0x67,0xa8,
+	0xd8,0xdc,0xc7,0x79,0x6a,0x93,0xc4,0x7e,0x56,0x1f,0x95,0x58,0xc5,0x79,0xe6,0x83,
+	0xab,0xc9,0xa7,0x4e,0x14,0xe5,0xa0,0x63,0xf3,0x2f,0xa7,0xb8,0xaf,0x43,0x89,0xd6,
+	0x58,0xd5,0xd0,0x82,0xac,0x32,0x08,0xac,0xe5,0xa1,0xc5,0x52,0x9f,0x23,0x0c,0x56,
+	0x7e,0xad,0x7e,0xb6,0x30,0xf4,0xcc,0x8d,0xf7,0x45,0x4f,0xa8,0xde,0xc7,0x63,0x09,
+	0x77,0x39,0x63,0xf7,0x57,0xd6,0xb8,0xdb,0xcb,0x99,0x2e,0xe6,0x32,0x4a,0x72,0x4f,
+	0x41,0xe9,0x44,0x75,0x2e,0x8d,0x2e,0x67,0x77,0xb1,0x1c,0xd2,0xbc,0xd2,0x34,0x92,
+	0x31,0x66,0x3d,0xe9,0x94,0x51,0x56,0x77,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x0a,0x8c,0xc8,0xc1,0x94,0x90,0xc3,0x90,0x45,0x75,0x7a,0x26,
+	0xa4,0x2f,0x13,0xcb,0x93,0x89,0x94,0x7e,0x62,0xb9,0x3a,0x7c,0x13,0x3c,0x12,0xac,
+	0x91,0xb1,0x56,0x1d,0xe8,0x6a,0xe6,0x75,0x29,0xa9,0xa3,0xbf,0xc5,0x18,0xaa,0x3a,
+	0x46,0xa2,0x97,0xd1,0x60,0xe1,0x66,0x5f,0xbc,0xbf,0xd6,0xb4,0x31,0x59,0xb7,0x63,
+	0x82,0x51,0x71,0x76,0x63,0x71,0x46,0x29,0xd8,0xa3,0x14,0xae,0x21,0xb8,0xa3,0x14,
+	0xec,0x51,0x8a,0x2e,0x03,0x71,0x46,0x29,0xd8,0xa3,0x14,0x5c,0x06,0xe2,0x8c,0x53,
+	0xb1,0x46,0x28,0xb8,0x0d,0xc5,0x18,0xa7,0x62,0x8c,0x51,0x70,0x1b,0x8a,0x31,0x4e,
+	0xc5,0x18,0xa2,0xe0,0x37,0x14,0x62,0x9d,0x8a,0x31,0x45,0xc0,0x6e,0x28,0xc5,0x3b,
+	0x14,0x62,0x8b,0x80,0xdc,0x51,0x8a,0x76,0x28,0xc5,0x17,0x01,0xb8,0xa3,0x14,0xec,
+	0x51,0x8a,0x2e,0x03,0x71,0x46,0x29,0xd8,0xa3,0x14,0x5c,0x09,0x31,0x46,0x2a,0x4c,
+	0x51,0x8a,0xce,0xe3,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,0x8c,0x54,
+	0x98,0xae,0x77,0xc4,0xda,0xea,0x58,0x21,0x82,0xdc,0x86,0xb9,0x61,0xff,0x00,0x7c,
+	0xd3,0x57,0x6e,0xc8,0x71,0x8b,0x93,0xb2,0x29,0xf8,0xa3,0x5e,0xf2,0x77,0x5a,0x59,
+	0xb7,0xef,0x3a,0x3b,0x8f,0xe1,0xf6,0x1e,0xf5,0xc5,0x92,0x49,0x24,0xf2,0x69,0x64,
+	0x76,0x91,0xd9,0xdc,0x92,0xcc,0x72,0x49,0xef,0x4d,0xae,0x88,0xab,0x23,0xb2,0x11,
+	0x51,0x56,0x41,0x45,0x14,0x53,0x2c,0x28,0xa2,0x8a,0x00,0x28,0xa2,0x8a,0x00,0x28,
+	0xa2,0x8a,0x00,0x28,0xa2,0x8a,0x00,0x28,0xa2,0x8a,0x00,0x28,0xa2,0x8a,0x00,0x28,
+	0xa2,0x8a,0x00,0x28,0xa2,0x8a,0x00,0x2b,0x7f,0xc3,0xba,0xd4,0xd6,0x41,0xa1,0x70,
+	0x64,0x87,0x1c,0x0c,0xfd,0xd3,0x58,0x51,0xa1,0x76,0xc2,0xd6,0x8c,0x31,0x88,0xd7,
+	0x03,0xaf,0x7a,0x4d,0x5c,0x4e,0x2a,0x5a,0x32,0xdd,0xe5,0xd4,0x97,0x73,0x99,0x25,
+	0x39,0x27,0xa0,0xf4,0xa8,0x28,0xa2,0x83,0x44,0xad,0xa2,0x0a,0x28,0xa2,0x80,0x0a,
+	0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,
+	0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,
+	0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x1f,
+	0x04,0xcf,0x04,0xab,0x24,0x4c,0x55,0x87,0x42,0x2b,0xb3,0xd1,0xf5,0x24,0xbf,0x8b,
+	0x07,0xe5,0x99,0x47,0xcc,0xbf,0xd6,0xb8,0x9a,0x9e,0xca,0xea,0x4b,0x39,0xd6,0x58,
+	0x8e,0x08,0xeb,0xee,0x2a,0x65,0x1b,0x99,0xd4,0xa6,0xa6,0xbc,0xcf,0x41,0xc5,0x18,
+	0xaa,0xda,0x65,0xf4,0x57,0xf0,0x07,0x43,0x87,0x1f,0x79,0x7d,0x2a,0xee,0x2b,0x06,
+	0xec,0x70,0xb4,0xd3,0xb3,0x23,0xc5,0x18,0xa9,0x31,0x46,0x28,0xb8,0x88,0xf1,0x46,
+	0x2a,0x4c,0x51,0x8a,0x2e,0x04,0x78,0xa3,0x15,0x26,0x28,0xc5,0x17,0x02,0x3c,0x51,
+	0x8a,0x93,0x14,0x62,0x8b,0x81,0x1e,0x28,0xc5,0x49,0x8a,0x31,0x45,0xc0,0x8f,0x14,
+	0x62,0xa4,0xc5,0x18,0xa2,0xe0,0x47,0x8a,0x31,0x52,0x62,0x8c,0x51,0x70,0x23,0xc5,
+	0x18,0xa9,0x31,0x46,0x28,0xb8,0x11,0xe2,0x8c,0x54,0x98,0xa3,0x14,0x5c,0x08,0xf1,
+	0x46,0x2a,0x4c,0x51,0x8a,0x2e,0x03,0xf1,0x46,0x29,0xf8,0xa3,0x15,0x95,0xc7,0x61,
+	0x98,0xa3,0x14,0xfc,0x56,0x2f,0x88,0xb5,0xb8,0xb4,0xa8,0x08,0x52,0x1e,0xe5,0x87,
+	0xca,0x9e,0x9e,0xe6,0x9a,0xbc,0x9d,0x90,0xd4,0x6e,0xec,0x8a,0xbe,0x29,0xd7,0x06,
+	0x9b,0x1f,0x91,0x07,0x37,0x2e,0x38,0x3f,0xdd,0x1e,0xb5,0xe7,0x92,0xc8,0xd2,0xc8,
+	0xcf,0x23,0x16,0x66,0x39,0x24,0xf7,0xa9,0x2e,0xee,0x25,0xba,0x9d,0xe6,0x9d,0xcb,
+	0x3b,0x1c,0x92,0x6a,0x1a,0xec,0x84,0x39,0x51,0xd7,0x08,0x28,0xa0,0xa2,0x8a,0x2a,
+	0x8b,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,
+	0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,0x80,0x0a,0x28,0xa2,
+	0x80,0x0a,0x74,0x68,0x5d,0xb0,0xb4,0x8a,0xa5,0x98,0x00,0x39,0xad,0x0b,0x78,0x84,
+	0x4b,0xee,0x7a,0xd0,0x34,0xae,0x3a,0x18,0x84,0x6b,0x81,0xd7,0xb9,0xa9,0x28,0xa2,
+	0x91,0x41,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,
+	0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,
+	0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,
+	0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x01,0x45,0x14,0x50,0x05,0x8b,0x1b,
+	0xb9,0x6c,0xe7,0x59,0x61,0x6c,0x11,0xd4,0x76,0x35,0xdc,0xe9,0x77,0xf1,0x6a,0x10,
+	0x07,0x8c,0x80,0xe3,0xef,0x2f,0x71,0x5e,0x7d,0x57,0x34,0xbb,0xe7,0xd3,0xee,0x84,
+	0xa9,0xc8,0xe8,0xc3,0xd4,0x54,0x4e,0x1c,0xc8,0xca,0xa5,0x3e,0x75,0xe6,0x7a,0x1e,
+	0x28,0xc5,0x43,0x63,0x77,0x15,0xed,0xba,0xcb,0x0b,0x64,0x1e,0xa3,0xb8,0x35,0x67,
+	0x15,0xc8,0xdd,0x8e,0x36,0xac,0x33,0x14,0x62,0x9f,0x8a,0x31,0x45,0xc5,0x61,0x98,
+	0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,0x61,
+	0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,0xe1,
+	0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,0xa2,
+	0xe1,0x61,0x98,0xa3,0x14,0xfc,0x51,0x8a,0x2e,0x16,0x19,0x8a,0x31,0x4f,0xc5,0x18,
+	0xa2,0xe1,0x61,0xf8,0xa3,0x14,0xa5,0xe3,0x07,0x05,0xd7,0x3f,0x51,0x59,0xda,0xde,
+	0xaf,0x6f,0xa5,0xda,0x19,0x5d,0x83,0x39,0xe1,0x10,0x1e,0x49,0xac,0xd6,0xae,0xc8,
+	0xa4,0xaf,0xa2,0x20,0xf1,0x26,0xac,0xba,0x4d,0x96,0xf0,0x03,0x4c,0xfc,0x22,0xe7,
+	0xf5,0xaf,0x30,0xbb,0xb9,0x96,0xee,0x77,0x9a,0x77,0x2f,0x23,0x1c,0x92,0x6a,0x5d,
+	0x4e,0xfe,0x7d,0x46,0xe9,0xa7,0xb8,0x6c,0xb1,0xe8,0x3b,0x01,0xe8,0x2a,0xa5,0x77,
+	0xd3,0xa7,0xc8,0xbc,0xce,0xa8,0x43,0x95,0x05,0x14,0x51,0x5a,0x16,0x14,0x51,0x45,
+	0x00,0x14,0x51,0x45,0x00,0x14,0x51,0x45,0x00,0x14,0x51,0x45,0x00,0x14,0x51,0x45,
+	0x00,0x14,0x51,0x45,0x00,0x14,0x51,0x45,0x00,0x14,0x51,0x45,0x00,0x14,0xaa,0xa5,
+	0x98,0x00,0x39,0xa0,0x02,0x4e,0x07,0x5a,0xbf,0x6d,0x0f,0x96,0xb9,0x3f,0x78,0xd0,
+	0x09,0x0b,0x04,0x22,0x35,0xff,0x00,0x6a,0xa6,0xa2,0x8a,0x45,0x85,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,0x05,0x14,0x51,0x40,
+	0x17,0x74,0xad,0x46,0x5d,0x3e,0xe0,0x3c,0x67,0x28,0x7e,0xf2,0xf6,0x22,0xbb,0xfb,
+	0x0b,0xb8,0xaf,0xad,0xd6,0x58,0x5b,0x20,0xf5,0x1d,0xc1,0xaf,0x33,0xad,0x2d,0x0b,
+	0x53,0x6d,0x36,0xef,0x71,0xcb,0x44,0xdc,0x32,0xff,0x00,0x5a,0xca,0xad,0x3e,0x65,
+	0x75,0xb9,0x95,0x4a,0x7c,0xda,0xad,0xcf,0x43,0xc5,0x18,0xa6,0x41,0x75,0x04,0xf0,
+	0xac,0x91,0xca,0x85,0x58,0x64,0x73,0x4f,0xf3,0x62,0xff,0x00,0x9e,0x89,0xff,0x00,
+	0x7d,0x0a,0xe1,0xb9,0xc8,0x18,0xa3,0x14,0x79,0xb1,0x7f,0xcf,0x44,0xff,0x00,0xbe,
+	0x85,0x1e,0x6c,0x5f,0xf3,0xd1,0x3f,0xef,0xa1,0x45,0xc0,0x31,0x46,0x28,0xf3,0x62,
+	0xff,0x00,0x9e,0x89,0xff,0x00,0x7d,0x0a,0x5f,0x32,0x3f,0xf9,0xe8,0x9f,0xf7,0xd0,
+	0xa3,0x98,0x04,0xc5,0x18,0xa5,0xf3,0x23,0xfe,0xfa,0xfe,0x62,0x8d,0xe9,0xfd,0xf5,
+	0xfc,0xc5,0x1c,0xc0,0x26,0x28,0xc5,0x2e,0xf4,0xfe,0xfa,0xfe,0x62,0x8d,0xf1,0xff,
+	0x00,0x7d,0x7f,0x31,0x47,0x30,0x09,0x8a,0x31,0x4b,0xe6,0x47,0xff,0x00,0x3d,0x13,
+	0xfe,0xfa,0x14,0x9e,0x6c,0x7f,0xf3,0xd1,0x3f,0xef,0xa1,0x47,0x30,0x06,0x28,0xc5,
+	0x1e,0x6c,0x5f,0xf3,0xd1,0x3f,0xef,0xa1,0x47,0x9b,0x17,0xfc,0xf4,0x4f,0xfb,0xe8,
+	0x51,0x70,0x0c,0x51,0x8a,0x3c,0xd8,0xbf,0xe7,0xa2,0x7f,0xdf,0x42,0x8f,0x36,0x2f,
+	0xf9,0xe8,0x9f,0xf7,0xd0,0xa3,0x98,0x03,0x14,0x62,0x97,0xcc,0x8f,0xfe,0x7a,0x27,
+	0xfd,0xf4,0x28,0x0e,0x84,0xe0,0x3a,0x93,0xf5,0xa3,0x98,0x0f,0x18,0x8e,0x67,0x55,
+	0xe1,0xdb,0x03,0xde,0x99,0x24,0x8f,0x21,0xcb,0xb1,0x6f,0xa9,0xa6,0x13,0x49,0xb8,
+	0x56,0x78,0x39,0xd0,0xa0,0xaf,0x29,0x7b,0xcc,0x74,0x65,0x0a,0x6b,0x57,0xa8,0xb4,
+	0x53,0x77,0x8a,0x64,0x93,0xa4,0x63,0x2d,0x5d,0xaf,0x1d,0x47,0xa3,0x35,0x78,0x8a,
+	0x6b,0xa9,0x2d,0x15,0x4c,0x5f,0x2e,0xee,0x50,0xe2,0xac,0xc7,0x22,0xc8,0xbb,0x94,
+	0xf1,0x49,0xe3,0xa9,0x2d,0xee,0x4a,0xc5,0x53,0x7b,0x31,0xf4,0x52,0xe0,0x9a,0x36,
+	0x9a,0xcd,0xe6,0x54,0x57,0x71,0xfd,0x66,0x02,0x51,0x4b,0xb1,0xa8,0xda,0x69,0x7f,
+	0x69,0xd2,0xec,0xc5,0xf5,0x98,0xf6,0x12,0x8a,0x30,0x45,0x15,0x3f,0xda,0x90,0xfe,
+	0x56,0x2f,0xad,0x2e,0xc1,0x45,0x1b,0xc0,0xa3,0xcd,0xc5,0x4b,0xcd,0x17,0x48,0x89,
+	0xe2,0x97,0x44,0x18,0xa2,0x8f,0x3a,0x97,0xcc,0xcd,0x2f,0xed,0x47,0xfc,0x9f,0x88,
+	0x7d,0x6b,0xc8,0x4a,0x28,0xce,0x68,0xdb,0x9a,0x97,0x9a,0x4b,0xf9,0x49,0xfa,0xd3,
+	0xec,0x26,0xe1,0xea,0x29,0x0b,0xa8,0xef,0x4b,0xe5,0x67,0xb5,0x1e,0x4f,0xb5,0x2f,
+	0xed,0x49,0x76,0x0f,0xad,0x4b,0xb0,0xdf,0x31,0x7d,0x69,0xc1,0x81,0xef,0x4c,0x93,
+	0x6c,0x7d,0x7a,0xd4,0x6b,0x32,0xe7,0x91,0x4b,0xfb,0x46,0xab,0xd9,0x23,0x37,0x8d,
+	0x69,0xd9,0xd8,0xb7,0x14,0x9b,0x0e,0x40,0x04,0xfb,0xd5,0x81,0x71,0x21,0xfe,0xed,
+	0x53,0x52,0x08,0xc8,0xe9,0x4b,0xbf,0x15,0x9c,0xb3,0x1a,0xcf,0x6b,0x15,0xf5,0x99,
+	0xbd,0x8b,0xbe,0x6c,0x9f,0xec,0xd2,0xf9,0xb2,0xff,0x00,0xb3,0x54,0xbc,0xea,0x3c,
+	0xea,0x9f,0xed,0x0c,0x47,0x97,0xdc,0x1f,0x59,0xa8,0x5d,0x32,0xb8,0xee,0xb4,0xc6,
+	0xb9,0x71,0xe9,0x55,0x7c,0xdc,0xd2,0x6e,0xcd,0x47,0xd7,0x71,0x1f,0xcc,0x4f,0xd6,
+	0x2a,0x77,0x27,0x6b,0xc7,0x1d,0x85,0x46,0xd7,0xf2,0x8e,0x8a,0xb4,0xcc,0x66,0x8f,
+	0x2f,0x3d,0xa9,0xfd,0x7a,0xb3,0xde,0x40,0xeb,0xd4,0x7d,0x40,0xea,0x33,0xff,0x00,
+	0x75,0x68,0x1a,0x8c,0xff,0x00,0xdd,0x5a,0x4f,0x27,0xda,0x8f,0x27,0xda,0x8f,0xae,
+	0xd4,0xfe,0x62,0x7d,0xb5,0x4e,0xe4,0x8b,0x7d,0x31,0xec,0xb5,0x2a,0xdd,0xc8,0x7b,
+	0x2d,0x57,0xf2,0xf1,0xda,0x8c,0x62,0xa5,0xe3,0x2b,0x3d,0xa4,0x3f,0x6d,0x53,0xb9,
+	0x71,0x6e,0x18,0xf5,0xc5,0x4a,0x26,0xcf,0xa5,0x67,0x6f,0xc5,0x2f,0x9b,0x8a,0x97,
+	0x8a,0xaf,0xfc,0xcc,0x3d,0xb5,0x4e,0xe6,0x8f,0x9a,0x29,0x0c,0xbf,0x4a,0xcf,0xf3,
+	0xa8,0xf3,0x73,0x4b,0xeb,0x38,0x8f,0xe7,0x64,0xcb,0x11,0x38,0xab,0xb9,0x17,0x1a,
+	0xe0,0x8e,0x98,0xa8,0x9a,0xed,0xc7,0x40,0xb5,0x5f,0x7e,0x68,0xeb,0x54,0xb1,0x55,
+	0x97,0xda,0x62,0x8e,0x26,0x53,0xf8,0x64,0x3d,0xaf,0xa5,0x1d,0x96,0x98,0x75,0x09,
+	0xff,0x00,0xba,0xb4,0x6c,0xcf,0x6a,0x4f,0x27,0xda,0xa9,0x63,0x2a,0xff,0x00,0x31,
+	0x5e,0xda,0xa7,0x71,0x46,0xa3,0x3f,0xf7,0x56,0x9c,0x2f,0xe6,0x3f,0xc2,0xb4,0xcf,
+	0x27,0xda,0x97,0xcb,0xc7,0x6a,0x7f,0x5c,0xab,0xfc,0xc1,0xed,0xaa,0x77,0x27,0x5b,
+	0xc9,0x0f,0x50,0xb5,0x2a,0xdc,0xb1,0xea,0x05,0x53,0xc6,0x28,0xdd,0x8a,0x87,0x8b,
+	0xad,0xfc,0xcc,0x7e,0xda,0xa7,0x73,0x41,0x66,0xcf,0xa5,0x3b,0xcd,0x15,0x9d,0xe6,
+	0xe2,0x8f,0x3a,0xa7,0xeb,0x38,0x8f,0xe6,0x61,0xed,0xaa,0x77,0x34,0x0c,0xb4,0xc6,
+	0x9c,0x8e,0x98,0xaa,0x5e,0x76,0x68,0xdf,0x9a,0x6b,0x13,0x5f,0xf9,0x98,0x7b,0x6a,
+	0x9d,0xcb,0x0d,0x76,0xe3,0xa0,0x15,0x13,0x5f,0x4a,0x3a,0x05,0xa8,0xfa,0xd1,0xb3,
+	0x35,0x4b,0x17,0x59,0x7d,0xa0,0xf6,0xd5,0x3b,0x81,0xd4,0x26,0x1f,0xc2,0xb4,0x9f,
+	0xda,0x33,0xff,0x00,0x75,0x68,0xf2,0xbd,0xa8,0xf2,0x7d,0xaa,0xbe,0xbb,0x53,0xf9,
+	0x85,0xed,0xaa,0x77,0x1c,0x2f,0xe6,0x3f,0xc2,0xb5,0x2a,0xde,0xc8,0x7a,0x85,0xa8,
+	0x96,0x0a,0x71,0x8b,0x1c,0x8e,0x6a,0x5e,0x36,0xaf,0xf3,0x19,0x7d,0x76,0xcf,0x97,
+	0x9c,0x9d,0x6e,0x98,0xf5,0x02,0xa5,0x59,0xc9,0xeb,0x8a,0xa1,0x9c,0x52,0xf9,0x98,
+	0xa4,0xf1,0x55,0xdf,0xda,0x66,0xde,0xda,0xa7,0x73,0x44,0x4a,0x28,0x32,0xd6,0x77,
+	0x9d,0x47,0x9d,0x53,0xf5,0x9c,0x47,0xf3,0x30,0xf6,0xd5,0x3b,0x97,0x9a,0x72,0x3a,
+	0x62,0xa2,0x6b,0xa7,0x1d,0x00,0xaa,0xde,0x66,0x69,0x33,0x9a,0xa5,0x8a,0xaf,0xfc,
+	0xcc,0x3d,0xb5,0x4e,0xe3,0xae,0x6e,0x65,0x90,0x01,0xb8,0xae,0x3d,0x09,0xaa,0x6e,
+	0xf2,0xff,0x00,0xcf,0x47,0xff,0x00,0xbe,0x8d,0x5a,0xdb,0x9a,0x4f,0x2b,0x3d,0xaa,
+	0x1d,0x57,0x27,0x79,0x3d,0x4c,0xe4,0xdc,0x9d,0xd9,0x4f,0x74,0xd9,0xff,0x00,0x58,
+	0xff,0x00,0xf7,0xd1,0xa7,0x2b,0xcb,0xff,0x00,0x3d,0x1f,0xfe,0xfa,0x35,0x6b,0xc9,
+	0xf6,0xa3,0xca,0xc7,0x6a,0x3d,0xa1,0x36,0x19,0x1c,0x92,0x8f,0xf9,0x68,0xff,0x00,
+	0xf7,0xd1,0xab,0x29,0x34,0x83,0xfe,0x5a,0x3f,0xfd,0xf4,0x6a,0x2d,0x98,0xa3,0xa5,
+	0x66,0xdd,0xc7,0x62,0xea,0x4e,0xff,0x00,0xf3,0xd1,0xbf,0xef,0xaa,0x98,0x5c,0x3f,
+	0xf7,0xdb,0xf3,0xac,0xdf,0x33,0x14,0x79,0xd5,0x9b,0x83,0x60,0x69,0x9b,0x87,0xff,
+	0x00,0x9e,0x8d,0xf9,0xd4,0x6f,0x70,0xff,0x00,0xf3,0xd1,0xbf,0x3a,0xa1,0xe7,0x66,
+	0xac,0x24,0x2e,0xc0,0x16,0x38,0xa5,0xcb,0xcb,0xb9,0x15,0x2a,0xc6,0x9a,0xbc,0x9d,
+	0x84,0x92,0x69,0x0f,0xfc,0xb4,0x7f,0xfb,0xe8,0xd5,0x69,0x25,0x97,0xfe,0x7a,0x3f,
+	0xfd,0xf4,0x6a,0xc4,0xb0,0x32,0x82,0x73,0x91,0x50,0x6d,0xcd,0x69,0x17,0xd8,0x21,
+	0x38,0xd4,0x57,0x8b,0xb9,0x5d,0xde,0x5f,0xf9,0xe8,0xff,0x00,0xf7,0xd1,0xa8,0x8b,
+	0x4d,0xff,0x00,0x3d,0x5f,0xfe,0xfa,0x35,0x73,0xcb,0xcf,0x6a,0x3c,0x9f,0x6a,0xd1,
+	0x54,0x2a,0xc5,0x45,0x79,0xbf,0xe7,0xa3,0xff,0x00,0xdf,0x46,0xa6,0x49,0x25,0xcf,
+	0xfa,0xc7,0xff,0x00,0xbe,0x8d,0x4b,0xe5,0x7b,0x52,0xec,0xc7,0x6a,0x1c,0xee,0x16,
+	0x1e,0x92,0xc9,0xff,0x00,0x3d,0x1f,0xfe,0xfa,0x35,0x61,0x26,0x7c,0x60,0xbb,0x63,
+	0xdc,0xd5,0x4e,0x94,0x6f,0xc5,0x66,0xd5,0xc6,0x47,0x21,0xc5,0x57,0x79,0x31,0x53,
+	0xcb,0x55,0x24,0x06,0xb5,0x82,0x2a,0xc0,0x65,0x22,0xab,0x3b,0x17,0x6c,0x9a,0x74,
+	0x9c,0x54,0x75,0xba,0x49,0x18,0x54,0x7a,0xd8,0x2a,0x6b,0x69,0x4c,0x52,0x03,0xfc,
+	0x27,0xa8,0xa8,0x68,0xa6,0xd5,0xf4,0x33,0x4e,0xc7,0x45,0x18,0xdc,0x05,0x4e,0xb1,
+	0x8a,0xa7,0xa7,0x3e,0xfb,0x74,0xf5,0x1c,0x56,0x82,0x1a,0xf3,0xa7,0x74,0xec,0x76,
+	0x2d,0x55,0xc6,0xf9,0x63,0xd2,0x98,0xe8,0x07,0x5a,0x96,0x79,0x96,0x18,0x8b,0xb9,
+	0xe0,0x57,0x3f,0x75,0x77,0x24,0xee,0x49,0x62,0x17,0xd0,0x53,0xa7,0x09,0x4c,0x89,
+	0xcd,0x40,0xd4,0x70,0x3b,0x55,0x79,0x0e,0x2b,0x3a,0x39,0x9e,0x32,0x30,0xc7,0x1e,
+	0x95,0x74,0x48,0x25,0x4d,0xc3,0xf1,0xad,0xbd,0x9b,0x88,0xa1,0x35,0x32,0x37,0x7c,
+	0x54,0x46,0x43,0x4b,0x26,0x6a,0x06,0x06,0xb5,0x8a,0x45,0x58,0x94,0x48,0x7d,0x6a,
+	0x54,0x92,0xaa,0x80,0x6a,0x68,0xc1,0xa6,0xe2,0x82,0xc5,0xc8,0xce,0x6a,0xc4,0x63,
+	0x35,0x56,0x2a,0xb9,0x15,0x73,0x4c,0xa4,0x89,0x96,0x3a,0x49,0xf1,0x14,0x45,0xc8,
+	0xe9,0x52,0xa1,0xaa,0x7a,0xb4,0x9f,0x2a,0x20,0xef,0xc9,0xac,0xa3,0x79,0x4a,0xc4,
+	0xd4,0x7c,0xb1,0x6c,0xcd,0x76,0x2e,0xc4,0x9e,0xa6,0x9b,0x45,0x15,0xda,0x79,0xc4,
+	0x91,0x39,0x53,0x8e,0xc6,0x9e,0xef,0x8a,0x82,0x9e,0xfc,0x8a,0x9b,0x6a,0x75,0x50,
+	0x95,0xd5,0x86,0x34,0x94,0x9e,0x67,0xbd,0x46,0xc0,0xd0,0x88,0x58,0xe2,0xb4,0xb2,
+	0x36,0x7a,0x2b,0xb2,0x74,0x90,0xd5,0x84,0x6c,0xd4,0x0a,0xa0,0x0e,0x29,0xea,0xdb,
+	0x4d,0x64,0xec,0xcc,0x16,0x21,0x5f,0x62,0xe4,0x62,0xac,0x22,0x55,0x78,0x4e,0x40,
+	0x35,0x72,0x33,0xc5,0x73,0xcc,0xea,0x5a,0xec,0x28,0x8f,0x8e,0x94,0x86,0x3f,0x6a,
+	0x98,0x1a,0x46,0x35,0x95,0xd8,0xec,0x55,0x74,0xc5,0x57,0x7e,0x2a,0xdc,0x86,0xaa,
+	0x4b,0x5b,0x40,0x56,0x2b,0xbb,0x62,0xab,0xb4,0x86,0xa5,0x97,0x35,0x59,0xc1,0xae,
+	0x98,0xa4,0x2b,0x12,0xc2,0x4b,0xbe,0x33,0x56,0xaa,0xbd,0x9a,0xe1,0x49,0x3d,0xea,
+	0xc5,0x44,0xf7,0x3c,0xdc,0x44,0xf9,0xa7,0x6e,0xc1,0x4f,0x8c,0xf3,0x8a,0x65,0x28,
+	0x38,0x20,0xd4,0x99,0x53,0x9b,0x84,0x93,0x2e,0x22,0x66,0xa5,0x58,0xfd,0xa9,0x91,
+	0x1e,0x05,0x58,0x53,0x5c,0xf2,0x6c,0xf6,0x12,0x23,0x31,0x8f,0x4a,0x89,0xd0,0x0a,
+	0x9a,0x79,0x44,0x6b,0xea,0x4f,0x4a,0xa2,0xcc,0xcc,0x72,0x4d,0x38,0xa6,0xce,0x7a,
+	0xd8,0x88,0xd2,0x76,0xdd,0x8b,0x20,0xaa,0xce,0xd8,0xa9,0xc9,0x38,0xaa,0xf2,0xf7,
+	0xad,0xe2,0x55,0x2a,0xb1,0xaa,0xb4,0x21,0x79,0x2a,0x3f,0x33,0xde,0x91,0xc1,0xa8,
+	0x88,0x35,0xba,0x8a,0x34,0xb1,0x3a,0xc8,0x6a,0x64,0x7c,0xd5,0x45,0x06,0xac,0x45,
+	0x9a,0x52,0x48,0x76,0x2d,0xc7,0xcd,0x59,0x8d,0x73,0x55,0xa2,0xab,0x91,0x1a,0xe6,
+	0x98,0xec,0x3d,0x63,0x14,0x92,0x28,0x51,0xd3,0x9a,0x99,0x08,0xa8,0x66,0x39,0x7f,
+	0xa5,0x64,0x9b,0x6c,0xe7,0xc5,0xcf,0xd9,0xd3,0xd3,0x76,0x47,0x45,0x14,0x55,0x1e,
+	0x29,0x05,0xca,0xe0,0x6e,0x15,0x49,0xe4,0xc5,0x68,0xcc,0x37,0x46,0xc2,0xb2,0xa4,
+	0x07,0x35,0xbd,0x2d,0x4f,0x5b,0x09,0x37,0x38,0x59,0xf4,0x10,0xc8,0x69,0x44,0x86,
+	0xa1,0x60,0x6a,0xdd,0x85,0xa9,0x95,0xb7,0x37,0xdc,0x1f,0xad,0x6d,0x2b,0x45,0x5d,
+	0x9b,0xd4,0x9a,0xa7,0x1e,0x69,0x04,0x6e,0x4f,0xad,0x58,0x43,0x9a,0xba,0xa8,0xaa,
+	0x30,0xaa,0x00,0xa6,0x49,0x10,0x23,0x2a,0x30,0x6b,0x99,0xd4,0x4c,0xe5,0x86,0x36,
+	0x32,0x95,0x9a,0xb0,0xd8,0xd7,0x35,0x3a,0xc7,0x51,0x45,0x56,0x90,0xd6,0x52,0x67,
+	0x7d,0x86,0xf9,0x7e,0xd4,0xd6,0x8f,0xda,0xa7,0xcd,0x35,0xcd,0x42,0x6c,0x76,0x29,
+	0xc8,0xb8,0xaa,0xf2,0x71,0x56,0xe5,0x35,0x52,0x5e,0xf5,0xbc,0x05,0x62,0xbc,0x8f,
+	0x8a,0x84,0xc9,0x4e,0x97,0x35,0x03,0x03,0x9a,0xe9,0x8a,0x44,0xd8,0xd5,0xd2,0xe2,
+	0xf3,0x33,0x2b,0x72,0x07,0x00,0x56,0x9d,0x41,0x65,0x1f,0x97,0x6d,0x1a,0xf3,0xd3,
+	0x3c,0xd4,0xf5,0xc3,0x52,0x5c,0xd2,0x67,0xcf,0xe2,0x6a,0x3a,0x95,0x1b,0x0a,0xab,
+	0x2c,0x61,0x5f,0x23,0xa1,0xab,0x54,0xc9,0x46,0x57,0xe9,0x53,0x17,0x66,0x5e,0x0e,
+	0xab,0xa7,0x55,0x76,0x64,0x48,0x95,0x27,0x97,0xed,0x42,0x1a,0x94,0x1a,0x6d,0xb3,
+	0xe8,0x2c,0x42,0xd1,0xfb,0x54,0x2e,0x98,0xab,0xa0,0x67,0xad,0x2e,0x06,0x3a,0x52,
+	0xe7,0xb1,0xe7,0xd7,0xc7,0x42,0x94,0xb9,0x52,0xb9,0x92,0xfc,0x55,0x77,0x6c,0x56,
+	0xa5,0xe5,0xbe,0x54,0xba,0x76,0xea,0x2b,0x22,0x50,0x6b,0xa6,0x9b,0x52,0x3a,0x28,
+	0xd6,0x8d,0x68,0xf3,0x44,0x9d,0xc6,0x6a,0x26,0x8f,0x35,0x61,0x57,0x35,0x20,0x8f,
+	0x34,0xf9,0xac,0x74,0xd8,0xc8,0xbb,0x4d,0xbb,0x6a,0xbd,0x69,0xea,0x90,0xed,0x8d,
+	0x5f,0xd0,0xe2,0xb3,0x2b,0xa2,0x9b,0xbc,0x6e,0x72,0xd5,0x56,0x90,0x51,0x45,0x15,
+	0x66,0x66,0xa6,0x96,0xdb,0x61,0x3f,0x5a,0xd0,0x12,0xfb,0xd6,0x5d,0xa1,0xd9,0x0f,
+	0xd6,0xa4,0x32,0xd7,0x2c,0xe1,0xcd,0x26,0x76,0x43,0xe1,0x41,0xaa,0x4e,0x5d,0x95,
+	0x01,0xe0,0x72,0x6b,0x3e,0x9f,0x2b,0x6f,0x90,0x9a,0x65,0x6d,0x08,0xf2,0xab,0x1c,
+	0x73,0x77,0x93,0x61,0x53,0x5a,0xb6,0x24,0xc7,0x63,0x50,0xd3,0x90,0xe1,0xc1,0xf7,
+	0xa6,0xd5,0xd0,0xa2,0xec,0xee,0x5e,0x68,0xf3,0x51,0x98,0xbd,0xaa,0xf2,0xa6,0x40,
+	0xa7,0x88,0x6b,0x0e,0x7b,0x1d,0xf6,0x33,0x4c,0x7b,0x46,0x4f,0x4a,0x68,0x70,0x3a,
+	0x0a,0x75,0xd3,0xe6,0x42,0xa3,0xa0,0xe2,0xa0,0xad,0x16,0xab,0x53,0x92,0xa5,0x67,
+	0x7b,0x44,0xbb,0x03,0xab,0x74,0xeb,0x56,0x55,0xb1,0x59,0x4a,0x4a,0x90,0x47,0x5a,
+	0xba,0xb2,0x06,0x40,0x6a,0x25,0x13,0x5a,0x35,0x39,0xf4,0x7b,0x97,0x56,0x5c,0x77,
+	0xaa,0x57,0xed,0xba,0x50,0x7d,0xa9,0x0c,0xb8,0xa8,0x64,0x6d,0xc7,0x34,0xa3,0x0b,
+	0x3b,0x86,0x21,0x7b,0x83,0x28,0xa2,0x8a,0xd4,0xe0,0x0a,0x99,0x13,0x28,0x2a,0x1a,
+	0xbf,0x04,0x7f,0xbb,0x5a,0x99,0x3b,0x1d,0x18,0x65,0x79,0x32,0xa9,0x8b,0xda,0x9a,
+	0x17,0x6d,0x68,0xf9,0x5c,0x55,0x06,0xfb,0xc6,0xa5,0x4a,0xe6,0x98,0xa7,0x68,0xa4,
+	0x25,0x14,0x51,0x4c,0xe1,0x27,0xb6,0x7c,0x31,0x15,0x6d,0x64,0xc5,0x67,0xa9,0xc3,
+	0x03,0x4f,0x32,0x62,0xa6,0x50,0xb9,0xdf,0x86,0x95,0xe1,0x6e,0xc6,0x80,0x9b,0xde,
+	0x91,0xe7,0x00,0x64,0x9a,0xce,0xf3,0xa9,0xc4,0x93,0xd6,0xa7,0xd9,0x58,0xaa,0xd5,
+	0x7d,0x9a,0xf3,0x2c,0x35,0xce,0x4f,0x4e,0x29,0xbb,0x83,0x54,0x14,0xa0,0xe0,0xd3,
+	0xe5,0x4b,0x63,0x92,0x18,0xa9,0x27,0xef,0x6c,0x2b,0xa6,0x6a,0x23,0x16,0x7b,0x55,
+	0xb5,0x5d,0xc0,0x1a,0x90,0x45,0x9a,0x39,0xec,0x7a,0x29,0x5c,0xab,0x18,0xda,0x80,
+	0x53,0xa9,0xf2,0xa6,0xc6,0xc5,0x32,0x8b,0xdf,0x53,0xc6,0xac,0xad,0x36,0x14,0x51,
+	0x45,0x06,0x65,0x88,0xe4,0xc0,0x15,0x28,0x9b,0xde,0xa8,0x19,0x31,0x48,0x25,0xcb,
+	0x01,0x4b,0xd9,0xdc,0xf6,0xd7,0xbb,0x1d,0x4b,0x52,0x36,0xe6,0x26,0x99,0x45,0x15,
+	0x27,0x87,0x29,0x73,0x36,0xd8,0x53,0x24,0x5c,0xd3,0xe8,0xc6,0x78,0xa6,0x9d,0x8d,
+	0x70,0xd2,0xe5,0xa8,0x8a,0xad,0x1f,0xb5,0x34,0xc3,0x57,0xc4,0x59,0xa7,0x18,0x78,
+	0xcd,0x5f,0xb4,0xb1,0xec,0xb5,0x6d,0x59,0x41,0x20,0x2c,0x78,0xa9,0xd6,0xdf,0x03,
+	0xad,0x4e,0x06,0x28,0xa9,0x73,0x6c,0xf2,0xaa,0x63,0x26,0xe5,0xee,0x6c,0x44,0x06,
+	0xda,0x95,0x5f,0x14,0x8c,0x32,0x2a,0xbb,0x3e,0x28,0x4b,0x98,0xee,0xc3,0xd6,0xf6,
+	0xb1,0xf3,0x2e,0x89,0x7d,0xe8,0xce,0x79,0xac,0xf3,0x35,0x5d,0x81,0xb7,0xc4,0x0d,
+	0x4c,0xa1,0xcb,0xa9,0xcf,0x98,0x2f,0x71,0x31,0xf4,0x51,0x45,0x41,0xe5,0x01,0xe8,
+	0x6b,0x39,0xe3,0xc9,0x35,0xa2,0x7a,0x54,0x42,0x3c,0xd5,0xc1,0xd8,0xf4,0xf2,0xf8,
+	0xe9,0x26,0x50,0xf2,0x72,0x40,0xc5,0x6b,0x44,0x81,0x23,0x55,0x1d,0x85,0x46,0x91,
+	0x60,0x83,0x53,0x52,0xa9,0x3e,0x6d,0x08,0xcc,0x65,0xaa,0x80,0x51,0x45,0x15,0x99,
+	0xe6,0x90,0xc8,0x76,0xbf,0xd6,0x94,0x4b,0x8e,0xf4,0xdb,0xbe,0x10,0x1a,0xa4,0x65,
+	0xc5,0x6b,0x18,0xf3,0x23,0xde,0xc2,0x4f,0x9e,0x92,0x66,0x97,0x9d,0xef,0x4a,0xa4,
+	0xbf,0x4a,0xcf,0x81,0xbc,0xd9,0x02,0x0e,0xf5,0xa8,0xaa,0x15,0x40,0x15,0x33,0x8f,
+	0x29,0x9e,0x2f,0x15,0xec,0x57,0x2c,0x77,0x22,0x78,0x89,0x1c,0x1a,0xa9,0x22,0x90,
+	0x48,0x3d,0x6b,0x46,0xa2,0xb8,0x8c,0x3a,0xe7,0xb8,0xa5,0x19,0x59,0xea,0x72,0xe1,
+	0xf1,0xd2,0x72,0xe5,0xa9,0xb3,0x33,0x19,0x33,0x4c,0x11,0x7c,0xc3,0xeb,0x57,0x44,
+	0x79,0xa7,0x88,0xab,0x6e,0x7b,0x1e,0xb3,0x89,0x75,0x7e,0xe8,0xfa,0x52,0xd2,0x2f,
+	0x41,0x4b,0x5c,0x87,0xca,0xc9,0x59,0xb4,0xc2,0x9b,0x27,0x08,0xdf,0x4a,0x75,0x45,
+	0x72,0xdb,0x21,0x63,0x42,0xd5,0x97,0x49,0x5e,0x69,0x2e,0xe4,0x0b,0x2e,0x3b,0xd4,
+	0x91,0xc9,0xb9,0x80,0x07,0xad,0x66,0x99,0x71,0x56,0x74,0xd6,0x0f,0x71,0xf4,0x19,
+	0xae,0x89,0x42,0xc9,0xb3,0xe8,0xeb,0x4f,0xd9,0xd3,0x72,0xec,0x6a,0xd1,0x45,0x15,
+	0xc8,0x7c,0xb3,0xd4,0x2b,0x1a,0xf2,0x1d,0xb3,0x30,0x1d,0x3a,0x8a,0xd9,0xaa,0x77,
+	0xa8,0x0b,0x29,0xef,0x5a,0xd2,0x95,0xa4,0x77,0xe5,0xd3,0xb5,0x5e,0x5e,0xe5,0x78,
+	0xaa,0xd4,0x62,0xaa,0x46,0x6a,0xca,0x35,0x6b,0x34,0x7d,0x15,0x85,0xbc,0x83,0xce,
+	0xb6,0x75,0x03,0x9c,0x71,0x5c,0xc3,0x02,0xac,0x43,0x0c,0x11,0xd6,0xba,0xb0,0xf5,
+	0x97,0xa9,0xd9,0x89,0x09,0x96,0x21,0x86,0xee,0x3d,0x6a,0xe8,0x4f,0x95,0xd9,0x98,
+	0xd6,0xa4,0xe5,0xaa,0x31,0xe9,0xc8,0xa5,0x98,0x00,0x32,0x4d,0x31,0x59,0x59,0x82,
+	0x82,0x09,0x27,0x18,0xad,0x3b,0x7b,0x7f,0x29,0x72,0xdf,0x7f,0xf9,0x57,0x5c,0xa5,
+	0xca,0x61,0x1a,0x32,0x6f,0x55,0x61,0xad,0xf2,0xa8,0x1e,0x95,0x03,0xb1,0xab,0x32,
+	0x2e,0x6a,0xbb,0x21,0xa8,0x89,0xd7,0x62,0x23,0x49,0x4a,0xcb,0x8a,0x4a,0xa3,0xcf,
+	0x9a,0xb4,0x9a,0x0a,0x55,0xfb,0xc3,0xeb,0x49,0x53,0x5a,0xae,0xe9,0xd7,0xd8,0xe6,
+	0x87,0xa2,0x14,0x55,0xdd,0x8d,0xc8,0x87,0xca,0x3e,0x94,0xf9,0x88,0x8e,0x07,0x6e,
+	0x38,0x15,0x1c,0x6d,0xc5,0x32,0xfd,0xb3,0x68,0xe2,0xb8,0x6d,0x79,0x1e,0x94,0xb4,
+	0x8b,0x66,0x31,0x39,0x24,0xd2,0x51,0x45,0x76,0x1e,0x48,0x54,0xb1,0xb7,0xca,0x45,
+	0x45,0x4f,0x88,0x64,0x9a,0x4c,0xd6,0x8b,0xb4,0xd0,0x8e,0xd4,0xc5,0x7f,0x9b,0x9a,
+	0x91,0xd0,0xd4,0x7b,0x0e,0x6a,0xd5,0x8e,0xf9,0x47,0x99,0x59,0x92,0xd1,0x4d,0xce,
+	0xd5,0x25,0xba,0x0a,0x44,0x95,0x1d,0x82,0xab,0x02,0x4f,0x40,0x2a,0x2c,0x79,0xce,
+	0x84,0xd3,0xb5,0x89,0xa3,0x5d,0xce,0x05,0x6a,0xc4,0x38,0x15,0x4a,0x04,0x09,0xf5,
+	0xab,0x91,0xb6,0x2b,0x0a,0x8e,0xe7,0x6d,0x0a,0x5c,0x91,0xd7,0x72,0xc8,0x5f,0x94,
+	0xfd,0x2b,0x11,0xbe,0xf1,0xad,0xa5,0x7a,0xca,0xba,0x5d,0xb3,0xb7,0xbf,0x35,0x34,
+	0xb7,0x66,0x58,0xc8,0xe8,0x99,0x0d,0x14,0x51,0x5b,0x1c,0x01,0x51,0xc8,0xd5,0x28,
+	0x19,0xa8,0xdd,0x4d,0x54,0x4f,0x43,0x09,0x1f,0x71,0xb2,0x38,0x89,0x69,0x00,0xab,
+	0x75,0x04,0x0b,0x87,0x3f,0x4a,0x9e,0x89,0xee,0x72,0xe2,0xdf,0xbf,0x60,0xa2,0x8a,
+	0x2a,0x0e,0x52,0xdd,0xaf,0x2b,0x8f,0x4a,0xb8,0x8a,0x2a,0x85,0xa1,0xc1,0x35,0x79,
+	0x5e,0xb0,0x9a,0xd4,0xf6,0x70,0xce,0xf4,0xd5,0xc8,0xef,0x23,0xca,0x06,0x03,0x91,
+	0x54,0x6b,0x50,0xb8,0x23,0x07,0xa5,0x67,0xdd,0x85,0x84,0x17,0x27,0x09,0xfc,0xa9,
+	0xd3,0x7d,0x0e,0x6c,0x5e,0x1e,0x52,0x7c,0xf0,0x57,0x23,0xa4,0x63,0x81,0x4d,0x8e,
+	0x68,0xe4,0x7d,0xa8,0xe1,0x8e,0x33,0xc5,0x3d,0xc7,0x15,0xad,0x8c,0x28,0x61,0xa6,
+	0xe5,0x79,0x2b,0x22,0xac,0x8d,0x51,0xc6,0xdf,0xbd,0x5f,0xad,0x49,0x22,0x9a,0x88,
+	0xa1,0xce,0x6b,0x65,0x6b,0x1e,0x9c,0xa3,0x75,0x63,0x4e,0x8a,0x44,0x3b,0x90,0x1a,
+	0x5a,0xe6,0x3e,0x7d,0xab,0x3b,0x30,0xa7,0x47,0xf7,0xc5,0x36,0x9f,0x1f,0x0d,0x41,
+	0xb6,0x1e,0x3c,0xd5,0x22,0x8b,0x68,0xa2,0x92,0xe3,0x84,0xc7,0xad,0x22,0x3d,0x36,
+	0x76,0xce,0xda,0xca,0xda,0x9e,0xb6,0x29,0xf2,0xd2,0x93,0x44,0x34,0x51,0x45,0x68,
+	0x78,0x01,0x54,0xae,0x7e,0x57,0x35,0x76,0xaa,0x5e,0x0c,0xb0,0xfa,0x55,0xd3,0xdc,
+	0xed,0xc0,0xbf,0xde,0x58,0xa4,0xec,0x6a,0xee,0x99,0x36,0x77,0x21,0x3c,0xf5,0x15,
+	0x4d,0x90,0x9a,0x23,0x0c,0x8e,0x19,0x78,0x22,0xb7,0x94,0x54,0xa3,0x63,0xd2,0xad,
+	0x4b,0xda,0xc1,0xc4,0xdb,0xa2,0xaa,0xa5,0xe4,0x61,0x17,0xcd,0x60,0x84,0xf1,0xcd,
+	0x48,0xb7,0x51,0x39,0x22,0x37,0x0c,0x47,0xa5,0x72,0x38,0xb5,0xd0,0xf1,0x7e,0xad,
+	0x56,0xf6,0xe5,0x64,0xac,0x7b,0x54,0xb1,0x8a,0xaa,0xac,0x49,0xc9,0xab,0x28,0xd4,
+	0x9a,0xb1,0xed,0x61,0xa8,0xfb,0x18,0x72,0xf5,0x25,0x65,0xc2,0xd4,0x74,0xfd,0xf9,
+	0x18,0xa6,0x54,0x1e,0x76,0x65,0x06,0xa6,0xa4,0x14,0x51,0x45,0x07,0x9a,0x56,0xd4,
+	0x0e,0x21,0x1f,0x5a,0xc9,0x76,0x35,0xa5,0x7e,0x77,0x10,0xa3,0xb5,0x67,0x3a,0x1a,
+	0xeb,0xa2,0xad,0x13,0xde,0xc1,0x41,0xc6,0x8a,0xb9,0x7b,0x47,0x5d,0xcc,0xee,0x73,
+	0xc7,0x02,0xb5,0x2a,0x8e,0x90,0x31,0x6e,0xdf,0xef,0x55,0xea,0xe7,0xaa,0xef,0x36,
+	0x79,0x18,0xc9,0x37,0x5a,0x57,0x0a,0x28,0xa2,0xb3,0x39,0x88,0x95,0x79,0xa9,0x95,
+	0x45,0x44,0x5b,0x0e,0x69,0xea,0xf5,0x4e,0xe7,0xd4,0xd1,0x7c,0xd4,0xe3,0x27,0xd8,
+	0x93,0x18,0xa2,0x98,0x5e,0xa3,0x92,0xea,0x18,0x98,0x09,0x24,0x54,0x27,0xa6,0x6a,
+	0x39,0x59,0xe3,0x63,0x70,0x73,0x53,0x73,0x82,0xba,0x64,0xf5,0x47,0x53,0x93,0xe5,
+	0x08,0x0f,0xb9,0xa9,0x7e,0xd9,0x13,0x2b,0x18,0x98,0x39,0x1c,0x71,0xd2,0xb3,0xe6,
+	0x25,0xd8,0x93,0xc9,0xad,0x69,0x41,0xde,0xec,0xac,0x0e,0x12,0x7c,0xfe,0xd2,0x6a,
+	0xd6,0x2a,0x3b,0x55,0xcd,0x11,0xb3,0x74,0xdf,0xee,0xd5,0x47,0x43,0x4f,0xb0,0x3e,
+	0x55,0xdc,0x6c,0x7a,0x67,0x15,0xd5,0x35,0x78,0x34,0x7a,0x58,0x98,0x39,0xd2,0x94,
+	0x57,0x63,0xa4,0xa2,0x8a,0x2b,0xcc,0x3e,0x58,0x2a,0x1b,0x81,0x92,0xb5,0x35,0x54,
+	0x99,0xf3,0x2f,0xd2,0xae,0x0a,0xec,0xef,0xcb,0x60,0xe5,0x5d,0x3e,0xc5,0x10,0x71,
+	0x4e,0x12,0x63,0xbd,0x43,0x21,0xc5,0x40,0xf2,0x62,0xbb,0x94,0x6e,0x7d,0x2d,0x8b,
+	0xde,0x77,0xbd,0x35,0xe6,0xca,0x37,0x3d,0xab,0x3c,0xcb,0x41,0x97,0x2a,0x7e,0x94,
+	0xfd,0x90,0x23,0x1e,0xdb,0xfe,0x3f,0x13,0xfd,0xfa,0xe9,0xc9,0xcd,0x72,0xf6,0xff,
+	0x00,0xf1,0xf4,0x9f,0xef,0x57,0x4c,0x87,0x35,0x75,0xba,0x1d,0xb8,0xd5,0xac,0x40,
+	0xae,0x69,0xbe,0x56,0x6a,0xca,0x2e,0x6a,0x65,0x8f,0xda,0xb0,0x73,0xb1,0xc5,0x63,
+	0x32,0x6b,0x72,0xcb,0xc7,0x51,0x54,0x88,0x20,0xe0,0xf0,0x6b,0xa3,0xf2,0xbd,0xab,
+	0x23,0x5e,0x51,0x04,0x2b,0x2a,0x01,0xb8,0xb6,0x0d,0x5d,0x3a,0x97,0x76,0x31,0x9e,
+	0x15,0xd5,0x92,0xe4,0xdc,0xa5,0x57,0xad,0x23,0xd8,0x37,0x37,0xde,0x35,0x53,0x47,
+	0x6f,0x3c,0xc8,0xce,0x06,0x57,0x18,0xad,0x17,0x38,0x15,0x73,0x7a,0xf2,0x8a,0x38,
+	0x49,0x51,0x97,0xbf,0xb9,0x20,0x93,0x1d,0xe9,0x93,0xbe,0xf8,0x59,0x73,0x55,0x9d,
+	0xf1,0x51,0xb4,0xb5,0x2a,0x99,0xac,0x95,0xd5,0x88,0xe8,0xa3,0x39,0xa2,0xac,0xf2,
+	0x1a,0xb3,0xb3,0x0a,0x9e,0xd5,0x72,0x49,0xa8,0x2b,0x46,0xd2,0x3c,0x46,0x33,0xd4,
+	0xd4,0xc9,0xd9,0x1b,0xe1,0xa1,0xcd,0x3b,0xf6,0x1b,0xe5,0x66,0x93,0xc9,0xab,0xcb,
+	0x18,0x34,0xff,0x00,0x2b,0xda,0xb1,0xf6,0x96,0x3d,0x2e,0x53,0x26,0xea,0x2c,0x5b,
+	0x48,0x7f,0xd9,0x35,0x8b,0xa5,0xf3,0x7b,0x1d,0x75,0x1a,0x84,0x78,0xb3,0x98,0xff,
+	0x00,0xb2,0x6b,0x99,0xd2,0x3f,0xe3,0xfe,0x3f,0xc6,0xb7,0xa7,0x2b,0xc1,0x9d,0xd8,
+	0x65,0xfb,0xa9,0x9d,0x08,0xe2,0x94,0x3e,0x3b,0xd3,0x5f,0x8a,0x81,0xdf,0x15,0x9a,
+	0x8d,0xce,0x1b,0x16,0xc4,0xd8,0xef,0x50,0xce,0x43,0xf3,0xde,0xaa,0x34,0xb4,0x9e,
+	0x6d,0x52,0xa6,0x44,0xe0,0xa7,0x1e,0x56,0x4b,0x45,0x51,0xbc,0xba,0x78,0x4a,0x14,
+	0xc1,0xcf,0x5c,0xd5,0x8d,0x32,0x66,0x9d,0x19,0x9f,0x19,0xce,0x2a,0x9c,0x5a,0x57,
+	0x39,0x3f,0xb3,0x6a,0xf2,0xf3,0xbd,0x8b,0xa8,0x98,0x1c,0xf5,0xa0,0xc7,0x9a,0x95,
+	0x06,0x6a,0x74,0x8e,0xb1,0x72,0xb1,0xd9,0x0a,0x6a,0x2b,0x95,0x14,0x8c,0x7b,0x79,
+	0xa6,0xd6,0x91,0x87,0x2a,0x46,0x2b,0x3d,0xd4,0xab,0x10,0x46,0x08,0xa2,0x32,0xe6,
+	0x3c,0xec,0x75,0x3b,0x49,0x48,0x6d,0x14,0x51,0x54,0x70,0x12,0x46,0x76,0xe4,0xd4,
+	0x9e,0x6e,0x3b,0xd5,0x66,0x6c,0x54,0x2d,0x26,0x29,0xa8,0x5c,0xf7,0x68,0xc3,0x92,
+	0x09,0x1a,0x1e,0x7f,0xbd,0x52,0xd5,0xe4,0xdd,0x63,0x20,0xcd,0x45,0xe6,0xd4,0x17,
+	0xd2,0x6e,0xb5,0x71,0x55,0x1a,0x76,0x69,0x9d,0x14,0x7f,0x89,0x1f,0x52,0x1d,0x0c,
+	0xe2,0xe9,0xbf,0xdd,0xad,0xb3,0xcd,0x61,0x68,0xc7,0x17,0x27,0xfd,0xda,0xde,0x5e,
+	0x69,0xd5,0xf8,0x8d,0xf1,0x8b,0xf7,0xa3,0x0c,0x79,0xa4,0xf2,0x73,0x57,0x11,0x2a,
+	0x51,0x17,0xb5,0x61,0xcf,0x63,0x97,0x94,0xa5,0x1a,0x95,0x18,0xed,0x4e,0xab,0x66,
+	0x2f,0x6a,0xc4,0xd5,0xef,0x24,0xb3,0xba,0x09,0x18,0x04,0x15,0xcf,0x34,0x47,0xdf,
+	0x76,0x47,0x15,0x5c,0xba,0x55,0xa7,0x7a,0x5b,0x9a,0x14,0x9b,0xb1,0x55,0xec,0x65,
+	0x69,0xad,0x56,0x47,0xea,0x69,0xd2,0x36,0x2a,0x94,0x75,0xb1,0x58,0x7c,0x1f,0xb0,
+	0x6f,0x9f,0x72,0x71,0x2e,0x3b,0xd3,0x96,0x4d,0xe7,0x15,0x9e,0xd2,0x62,0x88,0xa7,
+	0xdb,0x20,0x24,0xf1,0x54,0xe9,0xe8,0x6b,0x88,0x87,0x3d,0x37,0x13,0x4a,0x8a,0x01,
+	0x04,0x02,0x3a,0x51,0x58,0x9f,0x38,0x15,0x0c,0xab,0xb9,0xaa,0x6a,0x15,0x73,0x4d,
+	0x3b,0x6a,0x7a,0x39,0x75,0x3b,0xc9,0xcf,0xb1,0x57,0xc9,0xcd,0x1e,0x4d,0x68,0x2c,
+	0x5e,0xd4,0xef,0x2b,0xda,0x9f,0xb4,0x3d,0x8e,0x53,0x9e,0xd6,0x53,0x6d,0xb2,0xff,
+	0x00,0xbd,0x51,0xe8,0x5f,0xf2,0xd7,0xf0,0xab,0xbe,0x23,0x4d,0xb6,0x89,0xfe,0xf5,
+	0x53,0xd0,0x3a,0x4d,0xf8,0x57,0x42,0x77,0xa7,0x73,0xba,0x2b,0xfd,0x99,0x9a,0xc0,
+	0xe2,0x9c,0x24,0xc7,0x7a,0x89,0xce,0x2a,0x06,0x93,0x15,0x9a,0x8d,0xce,0x1b,0x17,
+	0x7c,0xef,0x7a,0x9a,0x19,0x83,0xf0,0x4f,0x35,0x8e,0x65,0xa5,0x59,0x88,0x39,0x07,
+	0x9a,0x1d,0x1b,0xa3,0x9f,0x11,0x41,0x57,0x87,0x2b,0x37,0x29,0x1d,0x82,0xae,0x4d,
+	0x73,0xb3,0xeb,0x17,0x10,0xca,0xc8,0x36,0xb0,0xed,0x91,0x5a,0x36,0xf3,0x34,0xd0,
+	0xa3,0x39,0xc9,0x23,0x35,0x93,0xa1,0x25,0xab,0x38,0x56,0x4f,0x56,0x2d,0x4a,0xa3,
+	0x56,0x64,0x8f,0xf3,0xb1,0x26,0x99,0xe5,0x66,0xa7,0x45,0xcd,0x4e,0xb1,0xe6,0xab,
+	0x9a,0xc7,0xaa,0xa0,0x92,0xb2,0x1b,0x62,0x36,0xa3,0x2f,0xe3,0x56,0x69,0x88,0x9b,
+	0x4e,0x69,0xf5,0x84,0x9d,0xdd,0xcf,0x9f,0xcc,0x29,0x38,0x56,0x6f,0xb8,0x51,0x45,
+	0x32,0x67,0x09,0x19,0x26,0xa5,0x2b,0x9c,0x51,0x8b,0x93,0x51,0x45,0x49,0x64,0xfd,
+	0xe3,0x52,0x79,0xd8,0xef,0x54,0xdd,0xf9,0x35,0x13,0x4b,0x5d,0x8a,0x99,0xf5,0x70,
+	0x8f,0x24,0x54,0x7b,0x1a,0x3e,0x77,0xbd,0x63,0x78,0x81,0xf7,0x79,0x5f,0x8d,0x4e,
+	0x25,0xaa,0x3a,0xb3,0x6e,0xf2,0xff,0x00,0x1a,0xb8,0x53,0xe5,0x95,0xce,0xac,0x2f,
+	0xf1,0x51,0x73,0x43,0x3f,0xe8,0xad,0xfe,0xf5,0x68,0x11,0x9a,0xcd,0xd1,0x0f,0xfa,
+	0x3b,0x7f,0xbd,0x5a,0xc8,0x33,0x53,0x53,0x49,0x31,0x62,0x17,0xef,0x64,0x42,0x62,
+	0xcd,0x27,0x93,0xce,0x6a,0xf2,0xc7,0x4f,0x11,0x7b,0x56,0x5e,0xd2,0xc6,0x3c,0xa4,
+	0xb6,0xb2,0xef,0x8c,0x06,0xfb,0xc3,0xad,0x4f,0x54,0xf6,0x15,0x39,0x1c,0x1a,0xc2,
+	0x9f,0x5c,0xba,0x8e,0x79,0x22,0x1b,0x0e,0x18,0x80,0xd8,0xe6,0xb2,0x54,0x5c,0xdf,
+	0xba,0x79,0x15,0x32,0x6a,0x95,0x66,0xdd,0x0b,0x58,0xe9,0x27,0x94,0x44,0x84,0x93,
+	0xcf,0x61,0x59,0xa6,0x42,0x58,0x92,0x79,0x34,0x92,0x3b,0x38,0x0c,0xe7,0x27,0x15,
+	0x5d,0xdf,0x15,0xad,0x3a,0x76,0x47,0x5e,0x0f,0x06,0xb0,0xd1,0xd7,0x56,0xc5,0x96,
+	0xaa,0x49,0x57,0x5c,0x66,0xa0,0x78,0xc9,0xad,0xe2,0xec,0x77,0x58,0xa6,0x73,0x4a,
+	0x39,0xa9,0xcc,0x54,0xa2,0x23,0x5a,0x73,0x21,0x58,0xab,0x15,0x92,0x09,0x03,0xe5,
+	0xb2,0x0e,0x6b,0x56,0x2a,0x85,0x10,0x8a,0x99,0x38,0xac,0xa6,0xee,0x69,0x29,0x4a,
+	0x7f,0x13,0x2d,0xc5,0x56,0x92,0xa8,0xa3,0xe2,0xa6,0x59,0x6b,0x9e,0x51,0x15,0x8b,
+	0x7c,0x56,0x2f,0x8a,0x3f,0xe3,0xc9,0x3f,0xdf,0xad,0x1f,0x3b,0xde,0xb2,0xf5,0xf0,
+	0xf3,0x5a,0xaa,0xa2,0x96,0x3b,0xb3,0xc5,0x3a,0x51,0xb4,0xd3,0x35,0xa3,0xa5,0x44,
+	0x53,0xf0,0xf7,0x49,0xbf,0x0a,0xd1,0x96,0xb3,0xf4,0x48,0xde,0x21,0x2e,0xf5,0x2b,
+	0x9c,0x75,0x15,0xa0,0xfc,0xd6,0xf3,0xf8,0xd8,0xf1,0x3a,0xd4,0x76,0x29,0xc9,0x50,
+	0x36,0x6a,0xeb,0xa6,0x6a,0x23,0x11,0xad,0x23,0x24,0x73,0xd8,0x81,0x49,0x06,0x83,
+	0x2a,0x02,0x41,0x60,0x08,0xf5,0xa9,0xc4,0x55,0x91,0x7e,0x31,0x74,0xe2,0x9e,0x92,
+	0x62,0x86,0x0a,0x18,0x89,0xea,0xec,0x6c,0xdb,0x20,0x7c,0x31,0xe4,0x76,0xad,0x28,
+	0xaa,0x85,0x90,0xc5,0xbc,0x7f,0xee,0x8a,0xb8,0x8d,0x8a,0xe7,0x9e,0xa2,0x85,0x18,
+	0xd2,0xf7,0x62,0x5d,0x4a,0x94,0x62,0xa9,0xac,0x98,0xa7,0xf9,0xde,0xf5,0xce,0xe2,
+	0xcd,0x2c,0x49,0x70,0x8b,0x2c,0x4f,0x1b,0x74,0x61,0x83,0x59,0x30,0xe9,0x50,0xdb,
+	0x4c,0x24,0x46,0x72,0x47,0xad,0x68,0xb4,0xb5,0x13,0xbe,0x6b,0x48,0x73,0x47,0x44,
+	0x52,0x9c,0xa2,0x9a,0x4c,0x82,0x5a,0xa9,0x2d,0x5b,0x7e,0x6a,0x07,0x4c,0xd6,0xd1,
+	0x76,0x33,0xb1,0x49,0xa9,0xbc,0xd5,0xa3,0x11,0xa6,0xf9,0x3e,0xd5,0xb2,0x92,0x15,
+	0x8c,0xdd,0x43,0xa2,0x55,0xcd,0x17,0xfd,0x4b,0x7f,0xbd,0x50,0xea,0x50,0x39,0xd9,
+	0xb1,0x4b,0x7d,0x05,0x59,0xd2,0x23,0x64,0x80,0xef,0x52,0xa7,0x3d,0xe8,0x93,0x5c,
+	0xa7,0x6b,0x6b,0xea,0xe9,0x1a,0xb1,0x55,0xb8,0xf1,0x54,0x90,0xe2,0xa7,0x59,0x31,
+	0x5c,0x72,0x57,0x39,0x2c,0x5c,0x18,0xaa,0xf7,0x70,0x09,0x06,0xe5,0xe1,0xbf,0x9d,
+	0x02,0x5f,0x7a,0x43,0x2f,0xbd,0x42,0x4d,0x3d,0x09,0xa9,0x4e,0x35,0x23,0xcb,0x23,
+	0x29,0xa7,0x89,0x58,0x86,0x70,0x08,0x38,0x22,0xa7,0x0b,0x81,0x93,0x5c,0xed,0xd9,
+	0xcd,0xfc,0x87,0xfd,0xba,0xe9,0x33,0x95,0x5f,0xa5,0x75,0x4a,0x3c,0xb6,0x26,0x59,
+	0x6d,0x3a,0x0d,0x49,0x3b,0x95,0xa5,0xaa,0xcf,0x57,0x5d,0x73,0x50,0xb4,0x46,0xaa,
+	0x2e,0xc5,0xd8,0xa9,0xcd,0x2b,0x20,0x95,0x0a,0x9e,0x86,0xa7,0xf2,0x7d,0xa9,0xcb,
+	0x11,0xab,0xe6,0x40,0xae,0x9d,0xd1,0x15,0x9d,0xaa,0x43,0x26,0xe5,0x27,0x38,0xc7,
+	0x35,0xa7,0x15,0x57,0x45,0xc5,0x4e,0x87,0x15,0x8c,0xdd,0xca,0x93,0x72,0x77,0x91,
+	0x72,0x3a,0xb0,0xb8,0xaa,0x48,0xf8,0xa9,0x04,0xbe,0xf5,0xcd,0x28,0xb0,0xb1,0x64,
+	0xe2,0xb9,0x5f,0x13,0x7f,0xc7,0xf2,0xff,0x00,0xb9,0x5d,0x11,0x97,0xde,0xb9,0xed,
+	0x7a,0x39,0x26,0xbb,0x56,0x44,0x66,0x1b,0x7a,0x81,0x5a,0xe1,0xd5,0xa7,0xa9,0xd1,
+	0x85,0xb2,0xa9,0xa9,0x6f,0x4b,0xff,0x00,0x90,0x7c,0x7f,0x8d,0x3e,0x5a,0x6e,0x9c,
+	0x19,0x2c,0xa3,0x56,0x04,0x11,0xd8,0xd4,0x8e,0xb9,0xad,0x3e,0xd3,0x31,0xaa,0xaf,
+	0x36,0x52,0x92,0xa2,0x39,0xab,0x8d,0x19,0x35,0x1f,0x95,0x5a,0xa9,0x23,0x2b,0x12,
+	0xda,0x5d,0x6c,0x1b,0x64,0xfb,0xa3,0xa1,0xab,0x22,0xf2,0x02,0x01,0x12,0x29,0xcf,
+	0x6e,0xf5,0x44,0xc5,0xf2,0x9f,0xa5,0x63,0x5b,0xff,0x00,0xc7,0xd2,0x7f,0xbd,0x52,
+	0xe9,0xc6,0x5a,0x99,0x47,0x2a,0xa5,0x88,0x6e,0x6d,0xd8,0xea,0xb7,0xee,0x3c,0x74,
+	0xab,0x11,0xd5,0x34,0xe2,0xa7,0x47,0xc7,0x7a,0xc2,0x4b,0xb1,0xa5,0x2a,0x51,0xa5,
+	0x1e,0x58,0x97,0x57,0x14,0xfe,0x2a,0xa2,0xcb,0x4e,0xf3,0xbd,0xeb,0x17,0x16,0x69,
+	0x62,0x3d,0x46,0xd2,0x3b,0xc8,0x82,0x48,0x48,0x00,0xe7,0x8a,0xa7,0x6d,0x65,0x1d,
+	0x98,0x7f,0x2c,0xb1,0xdd,0xeb,0x57,0x5a,0x4c,0xd4,0x2e,0xd9,0xad,0x62,0xe4,0x95,
+	0x8a,0xe7,0x97,0x2f,0x2d,0xf4,0x2b,0xcb,0x55,0x24,0xab,0x8e,0x33,0x50,0xbc,0x64,
+	0xd6,0xf1,0x76,0x33,0xb1,0x4c,0xe6,0x81,0x56,0x0c,0x46,0x81,0x11,0xad,0x39,0x90,
+	0xac,0x63,0x5e,0x7f,0xc7,0xc3,0x56,0xf5,0x8f,0xfc,0x7b,0xc7,0xfe,0xed,0x63,0xde,
+	0xc1,0x29,0xb9,0x62,0xa8,0xc4,0x7a,0x81,0x5b,0x36,0x8a,0x56,0xde,0x30,0x46,0x0e,
+	0x29,0x54,0x7a,0x23,0xba,0xbd,0x9d,0x28,0x22,0xfc,0x55,0x69,0x2a,0x92,0x36,0x2a,
+	0x65,0x93,0x15,0xc7,0x25,0x73,0x8e,0xc5,0xbe,0x2a,0x39,0x5d,0x63,0x52,0xcc,0x70,
+	0xa3,0x93,0x51,0x79,0xde,0xf5,0x5a,0xfe,0x4c,0xd9,0xcc,0x3f,0xd9,0x35,0x0a,0x17,
+	0x66,0x55,0xb0,0xd0,0xc4,0x25,0x09,0x93,0x8b,0xdb,0x76,0x2a,0x16,0x55,0x62,0x7a,
+	0x00,0x73,0x55,0xee,0xa5,0x2f,0xf4,0x15,0xcd,0xe9,0x3c,0x5f,0x47,0xf8,0xd7,0x40,
+	0xfc,0xd7,0x43,0xa4,0xa9,0xc8,0x95,0x95,0xd3,0xc2,0x4e,0xe9,0xdd,0xf9,0x94,0xe4,
+	0xa8,0x1a,0xae,0x3a,0x66,0xa2,0x31,0x1a,0xda,0x32,0x46,0xd6,0x2b,0x0c,0xd1,0x24,
+	0x0b,0x3e,0x37,0x64,0x63,0xd2,0xac,0x08,0xaa,0x44,0x8c,0x8a,0xa7,0x21,0xc5,0xb8,
+	0xbb,0xa1,0x2c,0xa1,0x58,0x14,0xaa,0xe4,0x82,0x73,0xcd,0x68,0xc5,0x55,0x50,0x62,
+	0xa7,0x46,0xc5,0x73,0xcf,0x51,0xb6,0xe4,0xee,0xcb,0xb1,0xe3,0x15,0x30,0xc5,0x53,
+	0x59,0x31,0x4f,0x12,0xfb,0xd6,0x0e,0x2c,0x2c,0x4e,0xc4,0x57,0x0f,0x7b,0xff,0x00,
+	0x21,0x09,0x7f,0xdf,0xfe,0xb5,0xd8,0x19,0x7d,0xeb,0x93,0xba,0x82,0x66,0xbd,0x91,
+	0x84,0x6c,0x41,0x7c,0xe7,0x15,0xd1,0x86,0x56,0x6e,0xe7,0x5e,0x11,0xa4,0xdd,0xce,
+	0x81,0xbe,0xe0,0xfa,0x55,0x59,0x6a,0xcf,0xf0,0x8f,0xa5,0x44,0xe9,0x9a,0x71,0xd0,
+	0xe3,0x68,0x98,0x0c,0xd3,0xc4,0x79,0xa5,0x8c,0x66,0xac,0xc6,0xa2,0xb3,0x94,0xac,
+	0x5d,0x8a,0xde,0x4d,0x06,0x1a,0xbc,0x10,0x52,0x14,0x15,0x1e,0xd0,0x7c,0xa5,0x02,
+	0x98,0xa6,0x9e,0x2a,0xdc,0x8a,0x2a,0xac,0x95,0xa4,0x5d,0xc5,0x61,0x85,0xf1,0xde,
+	0x9a,0x65,0xc5,0x45,0x21,0xaa,0xee,0xf5,0xb2,0x85,0xc4,0x5c,0xf3,0xfd,0xe9,0x7c,
+	0xdc,0xd6,0x7e,0xfa,0x7a,0x3d,0x37,0x4c,0x0b,0xe1,0xf3,0x4e,0x1c,0xd5,0x68,0xce,
+	0x6a,0xd4,0x7c,0xd6,0x72,0x56,0x1d,0x85,0x11,0xe6,0x9c,0x21,0xa9,0xe3,0x5a,0x98,
+	0x20,0xac,0x9c,0xec,0x16,0x29,0x18,0x6b,0x9a,0xd5,0x86,0xdb,0xe9,0x07,0xd2,0xbb,
+	0x32,0x82,0xb2,0xaf,0x74,0x98,0x67,0x99,0xa5,0x76,0x70,0xc7,0xd2,0xae,0x95,0x54,
+	0x9e,0xa6,0xf4,0x24,0xa9,0xca,0xec,0x6d,0xa0,0xc5,0xac,0x5f,0xee,0x8a,0x79,0x6c,
+	0x77,0xa7,0xf9,0x62,0x28,0xd5,0x17,0x38,0x51,0x8a,0xaf,0x21,0xc5,0x52,0xd5,0x98,
+	0xcb,0x57,0x71,0xe6,0x5c,0x52,0x79,0xfe,0xf5,0x51,0xde,0xa3,0xdf,0x5a,0x2a,0x64,
+	0x9a,0x02,0x6c,0xf7,0xa5,0x0f,0x9e,0xf5,0x41,0x5e,0xa7,0x8d,0xb3,0x49,0xc2,0xc0,
+	0x5b,0x1c,0xd3,0x82,0x66,0x99,0x1d,0x5a,0x8d,0x6b,0x29,0x3b,0x0e,0xc4,0x5e,0x4e,
+	0x68,0xf2,0x2a,0xea,0xa0,0xa5,0x28,0x3d,0x2b,0x3f,0x68,0x3b,0x14,0x0c,0x58,0xa6,
+	0x95,0xc5,0x5d,0x75,0x15,0x5a,0x41,0x8a,0xa8,0xca,0xe2,0xb1,0x09,0x38,0xa6,0x99,
+	0x31,0x4d,0x94,0xd5,0x67,0x6a,0xda,0x31,0xb8,0xac,0x59,0x33,0x7b,0xd0,0x26,0xf7,
+	0xaa,0x05,0xe9,0x43,0xd5,0xfb,0x30,0x33,0x2e,0x0e,0x6e,0xdc,0xff,0x00,0xb5,0x5d,
+	0x22,0x1c,0xa2,0xfd,0x2b,0x24,0x59,0xc6,0xee,0x58,0x96,0xc9,0x39,0xad,0x58,0xba,
+	0x01,0x4a,0xa7,0x43,0xa6,0xb5,0x48,0xcd,0x24,0xba,0x12,0x05,0xcd,0x3b,0xca,0xcd,
+	0x49,0x18,0xab,0x08,0xa3,0x15,0xce,0xe7,0x63,0x9e,0xc5,0x4f,0x22,0x93,0xca,0xc5,
+	0x5f,0xd8,0x3d,0x29,0xac,0x82,0xa5,0x54,0x1d,0x8a,0x05,0x71,0x4d,0x27,0x15,0x62,
+	0x41,0x55,0x64,0x35,0xa4,0x5d,0xc5,0x60,0x32,0x62,0x9a,0x66,0xa8,0x24,0x6a,0x81,
+	0x9e,0xb5,0x50,0xb8,0x8b,0xde,0x77,0xbd,0x28,0x97,0x35,0x9e,0x1e,0xa5,0x46,0xa6,
+	0xe9,0xd8,0x0b,0xc0,0xe6,0x9c,0x06,0x6a,0x18,0x8d,0x5a,0x8c,0x66,0xb2,0x96,0x83,
+	0xb0,0xd1,0x16,0x69,0x7c,0x9a,0xb4,0x8a,0x2a,0x40,0x83,0xd2,0xb2,0x75,0x07,0x63,
+	0x3d,0xe1,0xc2,0x37,0xd2,0xb9,0x7b,0x6f,0xf8,0xfc,0x4f,0xf7,0xeb,0xb6,0x78,0xc1,
+	0x52,0x3d,0x6b,0x20,0x69,0x10,0x47,0x28,0x91,0x59,0xf2,0x0e,0x6b,0x5a,0x55,0x52,
+	0xbd,0xcd,0xe8,0xcd,0x41,0x34,0xfa,0x93,0x9e,0x29,0x85,0xf1,0x4f,0x92,0xaa,0xc8,
+	0xd4,0xe2,0xae,0x73,0xd8,0x98,0xcd,0x8a,0x4f,0x3f,0xde,0xa9,0x33,0xd3,0x77,0xd6,
+	0x9e,0xcc,0x46,0x80,0x97,0x34,0xe0,0xd9,0xaa,0x28,0xf5,0x62,0x33,0x52,0xe3,0x60,
+	0x2c,0x01,0x9a,0x78,0x8f,0x34,0x47,0xcd,0x59,0x8d,0x45,0x65,0x29,0x58,0x76,0x2b,
+	0x88,0x68,0x30,0xd5,0xe0,0x82,0x90,0xa0,0xac,0xfd,0xa0,0xec,0x51,0x31,0xe2,0x98,
+	0x46,0x2a,0xe4,0x8b,0x55,0x64,0xad,0x23,0x2b,0x8a,0xc4,0x65,0xb1,0xde,0x9a,0x65,
+	0xc7,0x7a,0x8e,0x43,0x55,0x9d,0xeb,0x55,0x0b,0x88,0xb9,0xe7,0xfb,0xd4,0x77,0x52,
+	0xe6,0xda,0x41,0xfe,0xc9,0xaa,0x9b,0xe9,0x49,0xde,0xa5,0x4f,0x43,0xc5,0x5f,0xb3,
+	0xb0,0xe3,0xa3,0x4c,0xa1,0xa5,0xff,0x00,0xc7,0xec,0x75,0xd1,0x0e,0x6b,0x2e,0xd6,
+	0xd2,0x38,0xe5,0x0e,0xa5,0xb2,0x2b,0x52,0x3e,0xd5,0x35,0x1d,0xd9,0xbd,0x79,0xaa,
+	0x92,0xba,0x1c,0x13,0x34,0xe1,0x0e,0x6a,0x68,0xd6,0xa7,0x08,0x2b,0x9d,0xce,0xc6,
+	0x16,0x29,0x79,0x34,0x86,0x2c,0x55,0xf2,0x82,0xa2,0x75,0x14,0x94,0xc7,0x62,0x99,
+	0x18,0xa6,0x96,0xc7,0x7a,0x96,0x41,0x8a,0xab,0x29,0xad,0x63,0xa8,0xac,0x38,0xcb,
+	0x8a,0x4f,0x3b,0xde,0xaa,0xbb,0xd4,0x45,0xeb,0x55,0x4c,0x45,0xf1,0x36,0x7b,0xd3,
+	0x84,0x99,0xef,0x59,0xea,0xf5,0x3c,0x6d,0x9a,0x4e,0x16,0x02,0xd8,0xe6,0x9e,0x13,
+	0x35,0x1c,0x75,0x6a,0x31,0x59,0x49,0xd8,0x76,0x23,0x8c,0xd5,0x94,0x6a,0xa4,0xa4,
+	0x8a,0x78,0x93,0x14,0xa5,0x1b,0x97,0x63,0x40,0x38,0xa4,0x67,0x15,0x4b,0xce,0xa3,
+	0xce,0xa8,0xf6,0x63,0x26,0x91,0xba,0xd5,0x59,0x3b,0xd2,0x99,0x33,0x4c,0x39,0x35,
+	0xa4,0x63,0x61,0x58,0xad,0x20,0xaa,0xee,0xa6,0xaf,0x94,0xcd,0x30,0xc5,0x9a,0xda,
+	0x32,0xb0,0xac,0x50,0xdb,0x4f,0x45,0x35,0x6f,0xc8,0xa5,0x11,0x62,0x9b,0x9a,0x0b,
+	0x0c,0x8c,0x62,0xad,0x47,0xc5,0x46,0x13,0x14,0xe0,0x48,0xac,0xe5,0xa8,0x58,0xb9,
+	0x1b,0x54,0xea,0xe2,0xa8,0x09,0x31,0x4e,0xf3,0xab,0x17,0x0b,0x8c,0xbc,0x5c,0x62,
+	0xa1,0x76,0xaa,0xfe,0x75,0x34,0xc9,0x9a,0x4a,0x16,0x00,0x90,0xd5,0x59,0x45,0x4e,
+	0x49,0x34,0xc2,0xb9,0xad,0xa3,0xa0,0x58,0xa2,0xeb,0x51,0xed,0xab,0xe6,0x2c,0xd2,
+	0x79,0x35,0xaa,0x9a,0x15,0x8a,0x6a,0xa6,0xa7,0x8c,0x62,0xa5,0x10,0xe2,0x9e,0x13,
+	0x14,0x9c,0xae,0x16,0x1f,0x1f,0x15,0x6a,0x33,0x55,0x47,0x14,0xf0,0xf8,0xac,0x64,
+	0xae,0x3b,0x17,0xd5,0xc5,0x38,0xb8,0xaa,0x02,0x6a,0x5f,0x38,0xd6,0x7e,0xcc,0x65,
+	0xa7,0x6c,0xd5,0x59,0x4e,0x69,0x0c,0xb9,0xa6,0x16,0x26,0xaa,0x31,0xb0,0x88,0x65,
+	0xaa,0xb2,0x2d,0x5d,0x23,0x34,0xc3,0x1e,0x6b,0x68,0xca,0xc2,0xb1,0x9e,0x54,0xe6,
+	0x95,0x54,0xe6,0xae,0xf9,0x34,0x08,0x6b,0x4e,0x74,0x16,0x20,0x8d,0x6a,0xdc,0x54,
+	0xd1,0x1e,0x29,0xe0,0x62,0xb3,0x93,0xb8,0x58,0xb3,0x11,0xab,0x28,0xd5,0x40,0x31,
+	0x14,0xf1,0x2e,0x2b,0x19,0x42,0xe3,0x2f,0xef,0x14,0xc7,0x7a,0xa9,0xe7,0x1a,0x43,
+	0x2e,0x6a,0x55,0x31,0x92,0x4a,0x6a,0xa4,0x95,0x21,0x6c,0xd3,0x08,0xcd,0x6b,0x15,
+	0x61,0x58,0xa9,0x22,0xe6,0xa0,0x65,0x35,0xa0,0x63,0xcd,0x30,0xc3,0x5b,0x29,0xa4,
+	0x2b,0x14,0x42,0xd4,0xc8,0xa6,0xac,0x79,0x34,0xe1,0x16,0x28,0x73,0x41,0x61,0x22,
+	0xab,0x71,0x1a,0x80,0x0c,0x53,0x83,0x11,0x58,0xcb,0x51,0xd8,0xbc,0x8d,0x8a,0x94,
+	0x38,0xaa,0x02,0x5c,0x52,0xf9,0xc6,0xb2,0x74,0xc6,0x5c,0x67,0x15,0x04,0x87,0x8a,
+	0x84,0xcd,0x4d,0x2f,0x9a,0x6a,0x16,0x10,0xd9,0x39,0xaa,0x92,0x0c,0xd5,0xa3,0x93,
+	0x4c,0x29,0x9a,0xda,0x2e,0xc2,0xb1,0x41,0x94,0xd3,0x76,0xd5,0xf3,0x0e,0x69,0x3c,
+	0x9a,0xd7,0x9d,0x05,0x8a,0xa8,0xa6,0xac,0xc4,0x29,0xc2,0x2c,0x53,0xc2,0xe2,0xa2,
+	0x52,0xb8,0x58,0x96,0x33,0x83,0x56,0xd1,0xaa,0x90,0x24,0x53,0xc4,0x98,0xac,0x65,
+	0x1b,0x8e,0xc6,0x80,0x71,0x48,0xce,0x2a,0x97,0x9d,0x47,0x9d,0x51,0xec,0xc6,0x4f,
+	0x23,0x55,0x59,0x0f,0x34,0xa6,0x4c,0xd3,0x09,0x26,0xae,0x31,0xb0,0xac,0x56,0x90,
+	0x55,0x67,0x53,0x57,0xca,0xe6,0x98,0x62,0xcd,0x6d,0x19,0x58,0x56,0x28,0x6d,0xa7,
+	0x22,0x9a,0xb9,0xe4,0xd2,0x88,0x71,0x57,0xce,0x82,0xc4,0x71,0x8c,0x55,0xa8,0xf8,
+	0xc5,0x46,0x13,0x14,0xf1,0x91,0x59,0x49,0xdc,0x2c,0x5c,0x8d,0xaa,0x75,0x71,0x59,
+	0xe1,0xf1,0x4f,0xf3,0xab,0x17,0x0b,0x8c,0xbc,0x5c,0x54,0x4e,0xd5,0x5b,0xce,0xa6,
+	0x99,0x73,0x49,0x53,0x01,0x65,0x35,0x56,0x51,0x53,0x12,0x4d,0x30,0xae,0x6b,0x68,
+	0xe8,0x16,0x29,0x3a,0xd4,0x45,0x4d,0x68,0x18,0xb3,0x4d,0xf2,0x6b,0x55,0x34,0x2b,
+	0x14,0x95,0x4e,0x6a,0xc4,0x63,0x15,0x28,0x86,0x9e,0x23,0xc5,0x27,0x3b,0x85,0x87,
+	0x47,0xd2,0xad,0x44,0x78,0xaa,0xc0,0x62,0x9e,0x1f,0x15,0x8c,0x95,0xc7,0x62,0x16,
+	0x6c,0x54,0x2d,0x26,0x29,0xf2,0xd5,0x59,0x0d,0x6d,0x18,0xdc,0xab,0x12,0x19,0xbd,
+	0xe8,0x12,0xfb,0xd5,0x52,0x79,0xa5,0x53,0x5a,0x72,0x20,0xb1,0x75,0x64,0xcd,0x4c,
+	0xa7,0x35,0x4e,0x33,0xcd,0x5b,0x8e,0xb2,0x92,0xb0,0x58,0xb0,0x8b,0x9a,0x94,0x45,
+	0x9e,0xd4,0x91,0x55,0x94,0xc5,0x73,0xc9,0xd8,0xab,0x10,0x79,0x34,0xd6,0x8b,0x15,
+	0x73,0x02,0xa3,0x7c,0x54,0xa9,0x30,0xb1,0x49,0xd7,0x15,0x0b,0x1c,0x55,0xa9,0x6a,
+	0xa4,0xb5,0xb4,0x75,0x15,0x88,0x9a,0x4c,0x54,0x66,0x5f,0x7a,0x6c,0x86,0xa0,0x63,
+	0x5d,0x11,0x8a,0x15,0x8b,0x22,0x6f,0x7a,0x7a,0xc9,0x9a,0xa4,0x0d,0x4d,0x19,0xa1,
+	0xc1,0x05,0x8b,0xaa,0x73,0x53,0x22,0xe6,0xab,0xc5,0x56,0xe2,0xac,0x25,0xa0,0xec,
+	0x3d,0x63,0xcd,0x3b,0xc9,0xa9,0x53,0x15,0x28,0x02,0xb0,0x72,0x63,0xb1,0x50,0xc5,
+	0x51,0xb2,0x62,0xae,0xb0,0x15,0x5e,0x5c,0x55,0x46,0x57,0x0b,0x14,0xdb,0x8a,0x85,
+	0xdf,0x15,0x34,0xb5,0x52,0x53,0x5d,0x11,0x57,0x26,0xc2,0x99,0x7d,0xe9,0x04,0xde,
+	0xf5,0x5d,0x8d,0x30,0x1a,0xd5,0x41,0x05,0x8b,0xab,0x2f,0xbd,0x4c,0x8d,0x9a,0xa2,
+	0x86,0xad,0x45,0x51,0x28,0xd8,0x2c,0x5a,0x41,0x9a,0x99,0x63,0xcd,0x45,0x15,0x5b,
+	0x8f,0x15,0xcf,0x27,0x61,0xd8,0x60,0x8a,0x83,0x15,0x59,0x00,0x50,0xc0,0x56,0x7c,
+	0xcc,0x76,0x29,0x34,0x78,0xa8,0x5c,0x62,0xae,0x49,0x55,0x25,0xad,0x62,0xee,0x2b,
+	0x10,0x3b,0x62,0xa2,0x69,0x71,0xde,0x89,0x6a,0xb3,0x9a,0xe8,0x8c,0x6e,0x2b,0x13,
+	0x79,0xde,0xf4,0xe1,0x2e,0x7b,0xd5,0x3c,0xd4,0x88,0x6a,0x9c,0x10,0x58,0xbc,0x8f,
+	0x9a,0x95,0x39,0xaa,0xb1,0x1a,0xb7,0x15,0x63,0x25,0x60,0xb1,0x32,0xa6,0x6a,0x41,
+	0x15,0x2c,0x75,0x61,0x40,0xae,0x79,0x48,0xab,0x15,0x8c,0x34,0xc6,0x8f,0x15,0x70,
+	0x81,0x51,0x49,0x42,0x93,0x0b,0x14,0x9c,0x62,0xa1,0x76,0xc5,0x58,0x96,0xaa,0x4b,
+	0x5b,0xc7,0x51,0x58,0x63,0x49,0x8e,0xf4,0xd3,0x37,0xbd,0x44,0xe6,0xa1,0x26,0xb7,
+	0x50,0x42,0xb1,0x70,0x4b,0xef,0x52,0x23,0xe6,0xa8,0xa9,0xab,0x11,0x9e,0x69,0x4a,
+	0x28,0x2c,0x5c,0x5e,0x6a,0x65,0x4c,0xd4,0x11,0x55,0xc8,0xab,0x9e,0x5a,0x0d,0x20,
+	0x11,0x66,0x97,0xc9,0xa9,0xd0,0x0a,0x7e,0x05,0x62,0xe4,0xc7,0x62,0x9b,0x47,0x8e,
+	0xd5,0x0b,0xae,0x2a,0xf3,0xe2,0xaa,0xcb,0x57,0x17,0x71,0x58,0xac,0xc7,0x15,0x0b,
+	0x49,0x8a,0x7c,0xb5,0x56,0x43,0x5d,0x11,0x57,0x15,0x87,0x99,0x7d,0xe8,0x13,0x7b,
+	0xd5,0x56,0x34,0x29,0xad,0x39,0x10,0x58,0xbc,0xb2,0x66,0xa6,0x53,0x9a,0xa5,0x19,
+	0xe9,0x56,0xe2,0xac,0xe4,0xac,0x16,0x2c,0x22,0xe6,0xa5,0x58,0xb3,0x4d,0x8a,0xad,
+	0x26,0x2b,0x9e,0x4e,0xc3,0xb1,0x0f,0x93,0x48,0x62,0xc5,0x5b,0xc0,0xa6,0x38,0x15,
+	0x0a,0x4c,0x76,0x29,0x3a,0x62,0xa1,0x63,0x8a,0xb5,0x2d,0x54,0x97,0xbd,0x6d,0x1d,
+	0x45,0x62,0x26,0x7c,0x54,0x46,0x5f,0x7a,0x49,0x0d,0x57,0x63,0x5d,0x11,0x8a,0x15,
+	0x8b,0x22,0x6f,0x7a,0x7a,0xc9,0x9a,0xa4,0x0d,0x4a,0x86,0x9b,0x82,0x0b,0x17,0x91,
+	0xb3,0x52,0xa0,0xcd,0x57,0x8a,0xad,0xc5,0x58,0x4b,0x41,0xd8,0x7a,0xc7,0x9a,0x78,
+	0x86,0xa4,0x4c,0x54,0xc0,0x0a,0xc1,0xc9,0x8e,0xc5,0x43,0x15,0x46,0xc9,0x8a,0xba,
+	0xc0,0x54,0x12,0xe2,0x88,0xc8,0x2c,0x53,0x6e,0x2a,0x17,0x7c,0x54,0xd2,0xd5,0x49,
+	0x4d,0x74,0x45,0x5c,0x9b,0x13,0xc8,0x33,0x55,0xd9,0x33,0x56,0xc0,0xcd,0x2f,0x97,
+	0x9e,0xd4,0xd4,0xac,0x5d,0x8c,0xf3,0x17,0xb5,0x28,0x8f,0xda,0xb4,0x3c,0x9f,0x6a,
+	0x4f,0x27,0xda,0x9f,0xb4,0x0e,0x52,0xaa,0x26,0x2a,0xc2,0x71,0x4e,0xf2,0xf1,0x49,
+	0xd2,0xa5,0xbb,0x85,0x89,0xd1,0xb1,0x53,0x2c,0x95,0x47,0x7e,0x29,0x3c,0xdc,0x54,
+	0x38,0x5c,0x66,0x8f,0x9a,0x29,0xad,0x25,0x50,0xf3,0xa8,0xf3,0x73,0x4b,0xd9,0x01,
+	0x61,0xdb,0x35,0x5d,0xf9,0xa5,0xdd,0x9a,0x5c,0x66,0xad,0x2b,0x05,0x8a,0xae,0x99,
+	0xa8,0xcc,0x5e,0xd5,0x7f,0xcb,0xcd,0x1e,0x4f,0xb5,0x5a,0x9d,0x85,0x63,0x3c,0x45,
+	0xed,0x52,0x2a,0x62,0xae,0xf9,0x3e,0xd4,0x9e,0x5e,0x28,0xf6,0x97,0x0b,0x11,0xc6,
+	0x31,0x56,0x11,0xb1,0x51,0x63,0x14,0x85,0xb1,0x50,0xd5,0xc7,0x62,0xea,0xc9,0x4f,
+	0xf3,0x6b,0x3b,0xcd,0xc5,0x1e,0x75,0x47,0xb3,0xb8,0x1a,0x0d,0x2d,0x42,0xef,0x9a,
+	0xab,0xe7,0x52,0xef,0xcd,0x35,0x4e,0xc0,0x2b,0xf3,0x55,0xdd,0x73,0x56,0x3a,0xd2,
+	0xec,0xcd,0x5a,0x76,0x15,0x8a,0x0d,0x1f,0xb5,0x27,0x95,0xed,0x5a,0x1e,0x4f,0xb5,
+	0x2f,0x93,0xed,0x55,0xed,0x03,0x94,0xa2,0xb1,0xd4,0xf1,0x8c,0x54,0xde,0x56,0x3b,
+	0x51,0xb7,0x14,0x9c,0xae,0x16,0x1d,0x19,0xc5,0x58,0x49,0x31,0x55,0x33,0x8a,0x43,
+	0x26,0x2a,0x1c,0x6e,0x33,0x40,0x4b,0x41,0x96,0xb3,0xbc,0xea,0x3c,0xea,0x9f,0x64,
+	0x05,0xb7,0x7c,0xd4,0x0e,0x73,0x4c,0xf3,0x33,0x4b,0x9c,0xd5,0x28,0xd8,0x08,0x64,
+	0x5c,0xd4,0x0d,0x1d,0x5e,0xdb,0x9a,0x3c,0xac,0xf6,0xab,0x53,0xb0,0xac,0x67,0xf9,
+	0x5e,0xd4,0xe5,0x8e,0xaf,0xf9,0x3e,0xd4,0x9e,0x56,0x3b,0x53,0xf6,0x81,0x62,0xbc,
+	0x6b,0x8a,0xb0,0x87,0x14,0x6c,0xc5,0x27,0x4a,0x97,0xa8,0xec,0x59,0x47,0xc5,0x4a,
+	0x25,0xaa,0x1e,0x66,0x29,0x3c,0xea,0x87,0x4e,0xe0,0x68,0x99,0x45,0x46,0xf2,0x66,
+	0xa9,0x79,0xd4,0xbe,0x66,0x69,0x7b,0x3b,0x01,0x2c,0x87,0x35,0x5e,0x41,0x9a,0x90,
+	0x1c,0xd1,0xb7,0x35,0x6b,0x40,0xb1,0x4d,0x92,0x98,0x62,0xf6,0xad,0x0f,0x2b,0x3d,
+	0xa9,0x7c,0x9f,0x6a,0xb5,0x52,0xc2,0xb1,0x9e,0xb1,0xfb,0x54,0xc8,0xb8,0xab,0x3e,
+	0x4f,0xb5,0x1b,0x31,0x43,0x9d,0xc2,0xc2,0x27,0x15,0x3a,0x3e,0x2a,0x0e,0x94,0x9b,
+	0xf1,0x50,0xd5,0xc7,0x62,0xfa,0xc9,0x4b,0xe6,0x8a,0xce,0xf3,0xa8,0xf3,0xaa,0x3d,
+	0x90,0x17,0x9a,0x4a,0x81,0xdb,0x35,0x07,0x9b,0x9a,0x5d,0xd9,0xa6,0xa1,0x60,0x1a,
+	0xe3,0x35,0x03,0x26,0x6a,0xd6,0x33,0x4b,0xe5,0xe6,0xb4,0x52,0xb0,0xac,0x67,0x98,
+	0xbd,0xa8,0x11,0x7b,0x56,0x87,0x93,0xed,0x47,0x93,0xed,0x4f,0xda,0x07,0x29,0x51,
+	0x13,0x15,0x61,0x38,0xa7,0xf9,0x78,0xa4,0xc6,0x2a,0x5b,0xb8,0x58,0x99,0x1b,0x15,
+	0x3a,0xc9,0x54,0x77,0x62,0x93,0xcd,0xc5,0x43,0x85,0xc6,0x68,0xf9,0xa3,0xd6,0x9a,
+	0xd2,0x55,0x0f,0x3a,0x8f,0x3b,0x34,0xbd,0x90,0x16,0x5d,0xf3,0x55,0xdf,0x9a,0x37,
+	0xe6,0x97,0xad,0x5a,0x56,0x0b,0x15,0x9d,0x33,0x51,0x34,0x7e,0xd5,0x7f,0xcb,0xcd,
+	0x1e,0x4f,0xb5,0x5a,0x9d,0x85,0x63,0x3c,0x45,0xed,0x52,0x2a,0x62,0xae,0xf9,0x3e,
+	0xd4,0x9e,0x56,0x28,0xf6,0x97,0x0b,0x11,0x46,0x31,0x56,0x23,0x6c,0x54,0x78,0xc5,
+	0x04,0xe2,0xa1,0xea,0x3b,0x16,0xd2,0x4a,0x90,0x4a,0x2b,0x3b,0xcd,0xc5,0x1e,0x75,
+	0x47,0xb3,0xb8,0x1a,0x0d,0x2d,0x44,0xef,0x9a,0xa9,0xe7,0x52,0xf9,0x99,0xa6,0xa9,
+	0xd8,0x07,0x3f,0x35,0x5e,0x45,0xcd,0x4f,0xd6,0x97,0x66,0x6a,0xd3,0xb0,0x58,0x74,
+	0x62,0xac,0xa2,0x55,0x78,0x8d,0x5a,0x8c,0x8a,0xca,0x66,0x96,0x1e,0x23,0x14,0x8d,
+	0x18,0xa7,0x86,0x14,0x16,0x15,0x9d,0xd8,0x58,0xac,0xeb,0x8a,0xad,0x27,0x15,0x6e,
+	0x43,0x55,0x24,0xeb,0x5b,0x40,0x56,0x2b,0x48,0xd8,0xaa,0xed,0x21,0xa9,0xa5,0x1c,
+	0xd5,0x67,0x53,0x9a,0xe9,0x8a,0x15,0x85,0xf3,0x3d,0xe9,0xca,0xe6,0xa2,0xdb,0x4f,
+	0x45,0x39,0xab,0x69,0x0a,0xc5,0xa8,0xdb,0x35,0x66,0x3e,0x6a,0xac,0x42,0xad,0xc5,
+	0xd6,0xb9,0xe6,0x55,0x8b,0x28,0xb9,0xa9,0x56,0x31,0x51,0xc6,0x6a,0x70,0xc2,0xb9,
+	0xe5,0x71,0xd8,0x69,0x8c,0x54,0x4e,0x95,0x39,0x61,0x51,0x48,0xd4,0x95,0xc2,0xc5,
+	0x49,0x05,0x56,0x90,0xe2,0xac,0xca,0x6a,0xac,0xa2,0xba,0x20,0x2b,0x15,0xdd,0xcd,
+	0x30,0xc9,0xef,0x4a,0xeb,0x51,0xe0,0xd7,0x42,0x48,0x9b,0x12,0x2c,0x87,0xd6,0xa7,
+	0x8d,0xb3,0x55,0x55,0x6a,0xc4,0x62,0x94,0x90,0xec,0x5b,0x8f,0x9a,0xb5,0x1a,0xe6,
+	0xaa,0xc7,0xda,0xad,0xc6,0x6b,0x96,0x63,0x48,0x99,0x50,0x53,0xbc,0xb1,0x42,0xb0,
+	0xa7,0x6e,0x15,0x8d,0xd8,0xec,0x40,0xe8,0x2a,0xbc,0x83,0x15,0x6d,0xda,0xaa,0xca,
+	0x78,0xad,0x21,0x70,0xb1,0x56,0x43,0x8a,0xac,0xef,0x8a,0xb1,0x2f,0x4a,0xab,0x20,
+	0xae,0x98,0x22,0x6c,0x30,0xc9,0xef,0x40,0x93,0xde,0x98,0x54,0xd0,0x14,0xd6,0xb6,
+	0x42,0xb1,0x65,0x1f,0x3d,0xea,0xcc,0x7c,0xd5,0x48,0xc5,0x5b,0x8b,0xa5,0x63,0x34,
+	0x3b,0x16,0xa3,0x19,0xa9,0xd1,0x2a,0x18,0xcf,0x4a,0xb2,0x8c,0x31,0x5c,0xd2,0xb9,
+	0x56,0x17,0xcb,0x14,0xc7,0x4a,0x97,0x70,0xa6,0x3b,0x71,0x50,0x9b,0x0b,0x15,0x64,
+	0x5c,0x55,0x69,0x0e,0x2a,0xd4,0x87,0xad,0x54,0x93,0xa1,0xad,0xe0,0x2b,0x15,0xe4,
+	0x6c,0x77,0xa8,0x4c,0x87,0xd6,0xa4,0x90,0x54,0x05,0x4d,0x74,0xc5,0x21,0x58,0x70,
+	0x90,0xfa,0xd4,0xa8,0xf5,0x5c,0x03,0x52,0xc6,0x31,0x4d,0xa4,0x16,0x2d,0xc6,0x73,
+	0x56,0xa3,0x15,0x52,0x2e,0x2a,0xdc,0x46,0xb9,0xe6,0x3b,0x16,0x11,0x2a,0x41,0x18,
+	0xa6,0xc6,0xc2,0xa5,0xdc,0x2b,0x9d,0xb6,0x3b,0x11,0xb2,0x0a,0x82,0x45,0xc5,0x59,
+	0x66,0x15,0x04,0x86,0x9c,0x6e,0x16,0x2a,0x49,0xc5,0x56,0x91,0xb1,0xde,0xac,0xc9,
+	0xde,0xaa,0x48,0x2b,0xa6,0x02,0xb1,0x13,0x48,0x7d,0x69,0xbe,0x67,0xbd,0x23,0x29,
+	0xcd,0x37,0x06,0xb7,0x49,0x13,0x62,0x64,0x7a,0xb1,0x1b,0x66,0xaa,0x22,0x9a,0xb5,
+	0x10,0xac,0xe4,0x87,0x62,0xdc,0x62,0xac,0x22,0x55,0x78,0x8d,0x5a,0x8c,0xd7,0x34,
+	0xca,0xb1,0x20,0x8c,0x50,0x63,0x14,0xe0,0xc2,0x82,0xc2,0xb2,0xbb,0x0b,0x15,0xdd,
+	0x2a,0xb4,0x82,0xad,0xc8,0xd5,0x52,0x5e,0xb5,0xac,0x05,0x62,0xb4,0x8d,0x8a,0xae,
+	0xee,0x6a,0x69,0x45,0x56,0x75,0xae,0xa8,0xa1,0x58,0x3c,0xcf,0x7a,0x72,0xb9,0xa8,
+	0x71,0x4f,0x55,0x35,0x6d,0x21,0x58,0xb5,0x1b,0x66,0xad,0x47,0xcd,0x54,0x88,0x55,
+	0xa8,0xba,0xd6,0x13,0x2a,0xc5,0xa8,0xd7,0x35,0x32,0xc6,0x31,0x51,0x46,0x6a,0xc2,
+	0xb0,0xae,0x69,0x5c,0x76,0x1a,0x63,0x15,0x1b,0xa5,0x4e,0x58,0x54,0x52,0x35,0x25,
+	0x70,0xb1,0x52,0x41,0x8a,0xad,0x21,0xc5,0x59,0x94,0xf1,0x55,0x65,0x15,0xd1,0x01,
+	0x58,0xae,0xef,0x8a,0x8c,0xc9,0xef,0x4e,0x91,0x6a,0x22,0x0d,0x74,0x24,0x89,0xb1,
+	0x22,0xc9,0xef,0x53,0x46,0xd9,0xef,0x55,0x95,0x4d,0x4f,0x18,0xa5,0x24,0x87,0x62,
+	0xe4,0x7c,0xd5,0x98,0xd7,0x35,0x56,0x3e,0xd5,0x6e,0x33,0x5c,0xd3,0x1d,0x8a,0xea,
+	0xd8,0xa9,0x16,0x5c,0x55,0x76,0x6c,0x54,0x4d,0x26,0x3b,0xd5,0xf2,0xdc,0xbb,0x17,
+	0xfc,0xea,0x0c,0xd5,0x9b,0xe7,0x52,0x89,0xa8,0xf6,0x40,0x5e,0x69,0x33,0x51,0x93,
+	0x9a,0x81,0x64,0xcd,0x4a,0xa7,0x34,0x72,0xd8,0x2c,0x31,0x97,0x34,0xc3,0x17,0xb5,
+	0x5a,0x54,0xcd,0x4a,0x22,0xcd,0x1c,0xf6,0x0b,0x19,0xfe,0x4f,0xb5,0x28,0x8b,0xda,
+	0xb4,0x3c,0x9a,0x43,0x16,0x29,0x7b,0x50,0xe5,0x2a,0x2a,0xe2,0xa4,0x53,0x8a,0x73,
+	0x26,0x2a,0x36,0x38,0xa7,0x7b,0x85,0x89,0x96,0x4c,0x53,0xfc,0xea,0xa2,0xd2,0x62,
+	0x98,0x66,0xa3,0xd9,0xdc,0x0d,0x1f,0x3b,0xde,0x9a,0xd2,0xe6,0xb3,0xfc,0xea,0x7a,
+	0xc9,0x9a,0x3d,0x9d,0x80,0xb2,0xcd,0x9a,0x89,0x97,0x34,0xaa,0x73,0x52,0x2a,0xe6,
+	0x8d,0x82,0xc5,0x63,0x17,0xb5,0x27,0x93,0xed,0x57,0xd6,0x2c,0xd3,0xbc,0x9a,0x5e,
+	0xd2,0xc1,0xca,0x67,0x88,0xbd,0xa9,0xea,0x98,0xab,0x86,0x1a,0x8d,0x93,0x14,0x73,
+	0xdc,0x2c,0x46,0x38,0xa9,0x15,0xf1,0x51,0xb7,0x15,0x13,0x3e,0x29,0xda,0xe1,0x62,
+	0xe8,0x9a,0x8f,0x3f,0xde,0xb3,0x8c,0xd8,0xa4,0xf3,0xa8,0xf6,0x40,0x68,0xb4,0xb9,
+	0xa8,0x99,0xb3,0x55,0x56,0x5c,0xf7,0xa9,0x55,0xb3,0x47,0x25,0x80,0x56,0x19,0xa8,
+	0xcc,0x79,0xed,0x53,0xa8,0xcd,0x4a,0xb1,0xe6,0x8e,0x6b,0x05,0x8a,0x3e,0x4f,0xb5,
+	0x1e,0x57,0xb5,0x68,0xf9,0x34,0x18,0x69,0x7b,0x50,0xe5,0x28,0xac,0x78,0xed,0x52,
+	0x28,0xc5,0x4c,0xd1,0xe2,0xa3,0x61,0x8a,0x7c,0xd7,0x0b,0x0e,0x57,0xc5,0x48,0x25,
+	0xc5,0x54,0x67,0xc5,0x46,0x65,0xc7,0x7a,0x39,0x2e,0x06,0x87,0x9f,0xef,0x48,0x66,
+	0xcd,0x67,0x79,0xd4,0xa2,0x5c,0xf7,0xa3,0xd9,0x01,0x71,0x9f,0x35,0x19,0xe6,0x98,
+	0xaf,0x9a,0x91,0x46,0x68,0xb5,0x82,0xc4,0x4d,0x1e,0x69,0x86,0x2f,0x6a,0xba,0xb1,
+	0xe6,0xa4,0x10,0xd2,0xf6,0x96,0x0e,0x53,0x3b,0xc9,0xf6,0xa7,0x08,0xf1,0xda,0xaf,
+	0xf9,0x34,0xc6,0x8f,0x14,0x7b,0x4b,0x87,0x29,0x5d,0x46,0x2a,0x45,0x6c,0x50,0xcb,
+	0x8a,0x89,0x9b,0x14,0xf7,0x0b,0x16,0x44,0xb8,0xa7,0x79,0xfe,0xf5,0x9e,0xd2,0xe3,
+	0xbd,0x37,0xce,0xa3,0xd9,0x81,0xa4,0x66,0xa8,0xda,0x4c,0xd5,0x21,0x35,0x48,0xaf,
+	0x9a,0x3d,0x9d,0x80,0x94,0xf3,0x51,0xb2,0x66,0x9e,0xbc,0xd4,0xaa,0x99,0xa2,0xf6,
+	0x0b,0x15,0x0c,0x5e,0xd4,0x9e,0x4f,0xb5,0x68,0x08,0x69,0x7c,0x9a,0x5e,0xd4,0x39,
+	0x4c,0xf1,0x17,0xb5,0x48,0xab,0x8a,0xb4,0xd1,0x62,0xa3,0x65,0xc5,0x1c,0xf7,0x0b,
+	0x0d,0x53,0x8a,0x95,0x64,0xc5,0x57,0x63,0x8a,0x89,0xa4,0xc7,0x7a,0x7c,0xb7,0x0b,
+	0x17,0xfc,0xea,0x3c,0xea,0xcd,0xf3,0xa9,0x7c,0xea,0x3d,0x90,0x17,0x9a,0x4c,0xd4,
+	0x6c,0x73,0x50,0x2c,0x99,0xa9,0x14,0xe6,0x8e,0x5b,0x05,0x84,0x65,0xcd,0x46,0x62,
+	0xf6,0xab,0x4a,0x99,0xa9,0x16,0x2c,0xd1,0xcf,0x60,0xb1,0x43,0xc9,0xf6,0xa5,0x11,
+	0x7b,0x56,0x87,0x93,0x48,0x62,0xc5,0x2f,0x6a,0x1c,0xa5,0x35,0x4c,0x54,0x80,0xe2,
+	0xa4,0x64,0xc5,0x44,0xc7,0x14,0xef,0x70,0xb1,0x32,0xc9,0x8a,0x78,0x9a,0xa8,0xb4,
+	0x98,0xa6,0x19,0xa8,0xf6,0x77,0x03,0x47,0xce,0xf7,0xa6,0xb4,0xb9,0xac,0xff,0x00,
+	0x3a,0x9e,0xb2,0xe7,0xbd,0x1e,0xce,0xc0,0x59,0x66,0xcd,0x46,0xc3,0x34,0x8a,0xd9,
+	0xa9,0x55,0x73,0x46,0xc1,0x62,0xb9,0x8f,0x3d,0xa9,0xbe,0x4f,0xb5,0x5f,0x58,0xb3,
+	0x4e,0xf2,0x69,0x7b,0x4b,0x07,0x29,0x9c,0x22,0xf6,0xa7,0xaa,0x63,0xb5,0x5d,0x30,
+	0xd3,0x1a,0x3c,0x51,0xed,0x2e,0x1c,0xa4,0x43,0x8a,0x91,0x5f,0x15,0x1b,0x71,0x51,
+	0x33,0xe2,0x9d,0xae,0x16,0x3f,0xff,0xd9,
+};
+#endif
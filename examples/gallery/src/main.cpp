@@ -0,0 +1,287 @@
+// decodes a grid of thumbnails from one large JPEG and reports
+// how long a full redraw takes at source resolution, with
+// decode time scaling, and from the decoded image cache
+#if __has_include(<Arduino.h>)
+#include <Arduino.h>
+#else
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#endif
+#include <driver/gpio.h>
+#include <driver/spi_master.h>
+#include <memory.h>
+#include <esp_lcd_panel_io.h>
+#include <esp_lcd_panel_ops.h>
+#include <esp_lcd_panel_vendor.h>
+
+#include "lcd_config.h"
+
+#include <gfx.hpp>
+#include <uix.hpp>
+
+// a 640x480 baseline JPEG. Replace it with your own photo from
+// https://honeythecodewitch.com/gfx/converter to try others
+#define GALLERY_PHOTO_IMPLEMENTATION
+#include "assets/gallery_photo.h"
+
+// these libs work with the ESP-IDF and Arduino
+#ifdef M5STACK_CORE2
+#include <esp_i2c.hpp>
+#include <m5core2_power.hpp>
+#endif
+
+#ifdef ARDUINO
+namespace arduino {}
+using namespace arduino;
+#else
+namespace esp_idf {}
+using namespace esp_idf;
+static uint32_t millis() {
+    return ((uint32_t)pdTICKS_TO_MS(xTaskGetTickCount()));
+}
+#endif
+
+
+using namespace gfx;
+using namespace uix;
+
+// lcd data
+static const size_t lcd_transfer_buffer_size = 16*1024;
+// for sending data to the display
+static uint8_t *lcd_transfer_buffer = nullptr;
+static uint8_t *lcd_transfer_buffer2 = nullptr;
+// 0 = no flushes in progress, otherwise flushing
+static esp_lcd_panel_handle_t lcd_handle = nullptr;
+
+// declare the format of the screen
+using screen_t = screen<rgb_pixel<LCD_BIT_DEPTH>>;
+
+// the main screen
+static screen_t gallery_screen;
+
+
+#ifdef M5STACK_CORE2
+static m5core2_power power(esp_i2c<1,21,22>::instance);
+#endif
+
+// indicates the LCD DMA transfer is complete
+static bool lcd_flush_ready(esp_lcd_panel_io_handle_t panel_io,
+                            esp_lcd_panel_io_event_data_t *edata,
+                            void *user_ctx) {
+    gallery_screen.flush_complete();
+    return true;
+}
+
+// flush a bitmap to the display
+static void uix_on_flush(const rect16& bounds,
+                             const void *bitmap, void* state) {
+    // adjust end coordinates for a quirk of Espressif's API (add 1 to each)
+    esp_lcd_panel_draw_bitmap(lcd_handle, bounds.x1, bounds.y1, bounds.x2 + 1, bounds.y2 + 1,
+                              (void *)bitmap);
+}
+// initialize the screen using the esp panel API
+// htcw_gfx no longer has intrinsic display driver support
+// for performance and flash size reasons
+// here we use the ESP LCD Panel API for it
+static void lcd_panel_init() {
+#ifdef LCD_PIN_NUM_BCKL
+    if(LCD_PIN_NUM_BCKL>-1) {
+        gpio_set_direction((gpio_num_t)LCD_PIN_NUM_BCKL, GPIO_MODE_OUTPUT);
+        gpio_set_level((gpio_num_t)4, LCD_BCKL_OFF_LEVEL);
+    }
+#endif
+    // configure the SPI bus
+    spi_bus_config_t buscfg;
+    memset(&buscfg, 0, sizeof(buscfg));
+    buscfg.sclk_io_num = LCD_PIN_NUM_CLK;
+    buscfg.mosi_io_num = LCD_PIN_NUM_MOSI;
+    buscfg.miso_io_num = -1;
+    buscfg.quadwp_io_num = -1;
+    buscfg.quadhd_io_num = -1;
+    // declare enough space for the transfer buffers + 8 bytes SPI DMA overhead
+    buscfg.max_transfer_sz = lcd_transfer_buffer_size + 8;
+
+    // Initialize the SPI bus on VSPI (SPI3)
+    spi_bus_initialize(LCD_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO);
+
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+    esp_lcd_panel_io_spi_config_t io_config;
+    memset(&io_config, 0, sizeof(io_config));
+    io_config.dc_gpio_num = LCD_PIN_NUM_DC;
+    io_config.cs_gpio_num = LCD_PIN_NUM_CS;
+    io_config.pclk_hz = LCD_PIXEL_CLOCK_HZ;
+    io_config.lcd_cmd_bits = 8;
+    io_config.lcd_param_bits = 8;
+    io_config.spi_mode = 0;
+    io_config.trans_queue_depth = 10;
+    io_config.on_color_trans_done = lcd_flush_ready;
+    // Attach the LCD to the SPI bus
+    esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_SPI_HOST, &io_config,
+                             &io_handle);
+
+    lcd_handle = NULL;
+    esp_lcd_panel_dev_config_t panel_config;
+    memset(&panel_config, 0, sizeof(panel_config));
+    panel_config.reset_gpio_num = LCD_PIN_NUM_RST;
+    if(LCD_COLOR_SPACE==ESP_LCD_COLOR_SPACE_RGB) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        panel_config.rgb_endian = LCD_RGB_ENDIAN_RGB;
+#else
+        panel_config.color_space = ESP_LCD_COLOR_SPACE_RGB;
+#endif
+    } else {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        panel_config.rgb_endian = LCD_RGB_ENDIAN_BGR;
+#else
+        panel_config.color_space = ESP_LCD_COLOR_SPACE_BGR;
+#endif
+    }
+    panel_config.bits_per_pixel = LCD_BIT_DEPTH;
+
+    // Initialize the LCD configuration
+    if (ESP_OK !=
+        LCD_PANEL(io_handle, &panel_config, &lcd_handle)) {
+        printf("Error initializing LCD panel.\n");
+        while (1) vTaskDelay(5);
+    }
+
+    // Reset the display
+    esp_lcd_panel_reset(lcd_handle);
+
+    // Initialize LCD panel
+    esp_lcd_panel_init(lcd_handle);
+    //  Swap x and y axis (Different LCD screens may need different options)
+    esp_lcd_panel_swap_xy(lcd_handle, LCD_SWAP_XY);
+    esp_lcd_panel_set_gap(lcd_handle, LCD_GAP_X, LCD_GAP_Y);
+    esp_lcd_panel_mirror(lcd_handle, LCD_MIRROR_X, LCD_MIRROR_Y);
+    esp_lcd_panel_invert_color(lcd_handle, LCD_INVERT_COLOR);
+    // Turn on the screen
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    esp_lcd_panel_disp_on_off(lcd_handle, true);
+#else
+    esp_lcd_panel_disp_off(lcd_handle, false);
+#endif
+#ifdef LCD_PIN_NUM_BCKL
+    // Turn on backlight (Different LCD screens may need different levels)
+    if(LCD_PIN_NUM_BCKL>-1) gpio_set_level((gpio_num_t)4, LCD_BCKL_ON_LEVEL);
+#endif
+
+    // initialize the transfer buffers
+    lcd_transfer_buffer = (uint8_t *)malloc(lcd_transfer_buffer_size);
+    if (lcd_transfer_buffer == nullptr) {
+        puts("Out of memory initializing primary transfer buffer");
+        while (1) vTaskDelay(5);
+    }
+    memset(lcd_transfer_buffer, 0, lcd_transfer_buffer_size);
+    // initialize the transfer buffers
+    lcd_transfer_buffer2 = (uint8_t *)malloc(lcd_transfer_buffer_size);
+    if (lcd_transfer_buffer2 == nullptr) {
+        puts("Out of memory initializing transfer buffer 2");
+        while (1) vTaskDelay(5);
+    }
+    memset(lcd_transfer_buffer2, 0, lcd_transfer_buffer_size);
+}
+
+// for access to colors in the native screen's format
+using color_t = color<typename screen_t::pixel_type>;
+
+// prepare the JPEG array into a stream
+const_buffer_stream photo_stm(gallery_photo,sizeof(gallery_photo));
+// every thumbnail shows the same photo
+jpg_image photo(photo_stm);
+
+using image_box_t = image_box<typename screen_t::control_surface_type>;
+constexpr static const size_t thumbs_columns = 2;
+constexpr static const size_t thumbs_rows = 2;
+static image_box_t thumbs[thumbs_columns*thumbs_rows];
+// thumbnails of the same photo at the same size share one entry
+static image_cache thumbs_cache(64*1024);
+
+// initialize the screens and controls
+static void screen_init() {
+    gallery_screen.dimensions({LCD_WIDTH,LCD_HEIGHT});
+    const int16_t w = LCD_WIDTH/thumbs_columns;
+    const int16_t h = LCD_HEIGHT/thumbs_rows;
+    for(size_t y = 0;y<thumbs_rows;++y) {
+        for(size_t x = 0;x<thumbs_columns;++x) {
+            image_box_t& thumb = thumbs[y*thumbs_columns+x];
+            thumb.bounds(srect16(x*w,y*h,(x+1)*w-2,(y+1)*h-2));
+            thumb.image(photo);
+            gallery_screen.register_control(thumb);
+        }
+    }
+    gallery_screen.background_color(color_t::black);
+}
+// redraws the whole gallery and reports how long it took
+static uint32_t gallery_redraw() {
+    uint32_t ms = millis();
+    gallery_screen.invalidate();
+    while(gallery_screen.dirty() || gallery_screen.flushing()) {
+        gallery_screen.update();
+    }
+    return millis()-ms;
+}
+
+#ifdef ARDUINO
+void setup() {
+    Serial.begin(115200);
+#else
+void loop();
+static void loop_task(void* arg) {
+    while(1) {
+        static int count = 0;
+        loop();
+        // tickle the watchdog periodically
+        if (count++ == 4) {
+            count = 0;
+            vTaskDelay(5);
+        }
+    }
+}
+extern "C" void app_main() {
+#endif
+#ifdef M5STACK_CORE2
+    power.initialize();
+#endif
+    lcd_panel_init();
+    gallery_screen.buffer_size(lcd_transfer_buffer_size);
+    gallery_screen.buffer1(lcd_transfer_buffer);
+    gallery_screen.buffer2(lcd_transfer_buffer2);
+    gallery_screen.on_flush_callback(uix_on_flush);
+    screen_init();
+#ifndef ARDUINO
+    TaskHandle_t loop_handle;
+    xTaskCreate(loop_task,"loop_task",4096,nullptr,20,&loop_handle);
+#endif
+}
+
+void loop() {
+    constexpr static const int redraws = 5;
+    static const char* pass_names[] = {
+        "source resolution",
+        "scaled to fit",
+        "scaled to fit, cached"};
+    static size_t pass = 0;
+    static char szsummary[128];
+    if(pass<(sizeof(pass_names)/sizeof(const char*))) {
+        const bool scale = pass!=0;
+        for(size_t i = 0;i<(sizeof(thumbs)/sizeof(image_box_t));++i) {
+            thumbs[i].scale_to_fit(scale);
+        }
+        gallery_screen.decoded_image_cache(pass==2?&thumbs_cache:nullptr);
+        // the first cached redraw decodes, the rest reuse it
+        uint32_t total = 0;
+        for(int i = 0;i<redraws;++i) {
+            total+=gallery_redraw();
+        }
+        snprintf(szsummary,sizeof(szsummary),"%s: %d ms per redraw",pass_names[pass],(int)(total/redraws));
+#ifdef ARDUINO
+        Serial.println(szsummary);
+#else
+        puts(szsummary);
+#endif
+        ++pass;
+    }
+    gallery_screen.update();
+}
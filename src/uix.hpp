@@ -3,15 +3,25 @@
 #include "uix_core.hpp"
 #include "uix_screen.hpp"
 #include "uix_label.hpp"
+#include "uix_numeric_label.hpp"
+#include "uix_paragraph.hpp"
 #include "uix_painter.hpp"
 #include "uix_qrcode.hpp"
 #include "uix_barcode.hpp"
 #include "uix_battery.hpp"
 #include "uix_canvas_control.hpp"
+#include "uix_mask.hpp"
+#include "uix_nine_slice.hpp"
+#include "uix_shape.hpp"
+#include "uix_image_cache.hpp"
+#include "uix_glyph_atlas.hpp"
+#include "uix_text_layout.hpp"
 #include "uix_vbutton.hpp"
 #include "uix_vlabel.hpp"
 #include "uix_vslider.hpp"
 #include "uix_vswitch.hpp"
+#include "uix_keypad.hpp"
 #include "uix_image_box.hpp"
+#include "uix_asset_box.hpp"
 #include "uix_display.hpp"
 #endif
\ No newline at end of file
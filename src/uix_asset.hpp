@@ -0,0 +1,171 @@
+#ifndef HTCW_UIX_ASSET_HPP
+#define HTCW_UIX_ASSET_HPP
+#include "uix_core.hpp"
+namespace uix {
+/// @brief The color model of the pixels in an asset
+enum struct asset_format : uint8_t {
+    /// @brief Red, green and blue, such as RGB565
+    rgb = 0,
+    /// @brief Grayscale or monochrome
+    gray = 1,
+    /// @brief Red, green, blue and alpha
+    rgba = 2,
+    /// @brief Alpha only, painted in a color of choice
+    alpha = 3,
+    /// @brief A format not described above
+    unknown = 255
+};
+/// @brief How the pixels in an asset are stored
+enum struct asset_compression : uint8_t {
+    /// @brief Rows of pixels laid out as they are in a gfx bitmap
+    none = 0,
+    /// @brief Run length encoded rows of 4 or 8-bit indices into a palette of pixels
+    rle = 1
+};
+namespace helpers {
+// maps a gfx pixel type to the asset format that stores it verbatim
+template <typename PixelType>
+struct asset_pixel_traits {
+    constexpr static const asset_format format =
+        gfx::helpers::is_same<PixelType, gfx::rgb_pixel<PixelType::bit_depth>>::value     ? asset_format::rgb
+        : gfx::helpers::is_same<PixelType, gfx::gray_pixel<PixelType::bit_depth>>::value  ? asset_format::gray
+        : gfx::helpers::is_same<PixelType, gfx::rgba_pixel<PixelType::bit_depth>>::value  ? asset_format::rgba
+        : gfx::helpers::is_same<PixelType, gfx::alpha_pixel<PixelType::bit_depth>>::value ? asset_format::alpha
+                                                                                           : asset_format::unknown;
+};
+}  // namespace helpers
+/// @brief A read only view over an image asset stored in the native format, usually a const array in flash or a memory mapped partition.
+/// The asset is a 16 byte header followed by the pixel data:
+/// - bytes 0-3: "UIXA"
+/// - byte 4: the format version (1)
+/// - byte 5: the asset_format
+/// - byte 6: the bit depth of a pixel
+/// - byte 7: the asset_compression
+/// - bytes 8-9: the width, little endian
+/// - bytes 10-11: the height, little endian
+/// - bytes 12-15: the stride in bytes between rows, little endian, or 0 if compressed
+///
+/// Uncompressed pixels are stored exactly as a gfx bitmap of that pixel type holds them in memory, so they can be copied to the display without conversion.
+///
+/// Run length encoded assets follow the header with:
+/// - byte 0: the bit depth of an index (4 or 8)
+/// - byte 1: reserved
+/// - bytes 2-3: the number of palette entries, little endian
+/// - the palette: each entry a pixel in the asset's format, big endian, padded to whole bytes
+/// - the row table: the offset of each row from the end of the table, 32-bit little endian
+/// - the rows: each a series of packets. A control byte with the high bit set is a run of (c&0x7F)+1 pixels
+/// of the index in the next byte. Otherwise it is followed by (c+1) literal indices, packed high nibble first if 4-bit.
+class native_asset final {
+    const uint8_t* m_data;
+    static uint16_t read16(const uint8_t* p) {
+        return (uint16_t)(p[0] | (p[1] << 8));
+    }
+    static uint32_t read32(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+   public:
+    /// @brief The size of the header that precedes the pixel data
+    constexpr static const size_t header_size = 16;
+    /// @brief The version of the format this code reads
+    constexpr static const uint8_t version = 1;
+    /// @brief Constructs an empty asset
+    native_asset() : m_data(nullptr) {
+    }
+    /// @brief Constructs a view over asset data
+    /// @param data The asset, starting with its header. Must remain valid for the lifetime of the view.
+    native_asset(const uint8_t* data) : m_data(data) {
+    }
+    /// @brief Provides access to the asset
+    /// @return A pointer to the header, or null if none
+    const uint8_t* data() const {
+        return m_data;
+    }
+    /// @brief Indicates whether the data is an asset this code can read
+    /// @return True if the header is valid, otherwise false
+    bool valid() const {
+        return m_data != nullptr && m_data[0] == 'U' && m_data[1] == 'I' && m_data[2] == 'X' && m_data[3] == 'A' &&
+               m_data[4] == version && m_data[6] != 0;
+    }
+    /// @brief Indicates the color model of the pixels
+    /// @return The format
+    asset_format format() const {
+        return (asset_format)m_data[5];
+    }
+    /// @brief Indicates the size of each pixel
+    /// @return The bit depth
+    uint8_t bit_depth() const {
+        return m_data[6];
+    }
+    /// @brief Indicates how the pixels are stored
+    /// @return The compression
+    asset_compression compression() const {
+        return (asset_compression)m_data[7];
+    }
+    /// @brief Indicates the size of the image
+    /// @return The width and height
+    size16 dimensions() const {
+        return size16(read16(m_data + 8), read16(m_data + 10));
+    }
+    /// @brief Indicates the bounds of the image from (0,0)
+    /// @return The bounding rectangle
+    rect16 bounds() const {
+        return rect16(point16::zero(), dimensions());
+    }
+    /// @brief Indicates the distance between rows
+    /// @return The stride in bytes
+    uint32_t stride() const {
+        return read32(m_data + 12);
+    }
+    /// @brief Provides access to the data following the header
+    /// @return A pointer to the first row
+    const uint8_t* begin() const {
+        return m_data + header_size;
+    }
+    /// @brief Indicates the size of a palette index in a compressed asset
+    /// @return The bit depth of an index
+    uint8_t index_bit_depth() const {
+        return begin()[0];
+    }
+    /// @brief Indicates the number of colors in the palette of a compressed asset
+    /// @return The number of palette entries
+    uint16_t palette_size() const {
+        return read16(begin() + 2);
+    }
+    /// @brief Provides access to the palette of a compressed asset
+    /// @return A pointer to the first palette entry
+    const uint8_t* palette() const {
+        return begin() + 4;
+    }
+    /// @brief Provides access to a row
+    /// @param y The row
+    /// @return A pointer to the start of the row's pixels, or to its first packet if compressed
+    const uint8_t* row(uint16_t y) const {
+        if (compression() == asset_compression::rle) {
+            const uint8_t* table = palette() + (size_t)palette_size() * ((bit_depth() + 7) / 8);
+            return table + (size_t)dimensions().height * 4 + read32(table + (size_t)y * 4);
+        }
+        return m_data + header_size + (size_t)y * stride();
+    }
+    /// @brief Indicates whether the asset holds uncompressed pixels of the given type
+    /// @tparam PixelType The gfx pixel type
+    /// @return True if the pixels can be copied as is, otherwise false
+    template <typename PixelType>
+    bool is_native() const {
+        return valid() && compression() == asset_compression::none &&
+               format() == helpers::asset_pixel_traits<PixelType>::format &&
+               bit_depth() == PixelType::bit_depth;
+    }
+    /// @brief Indicates whether the asset holds run length encoded indices into a palette of the given pixel type
+    /// @tparam PixelType The gfx pixel type
+    /// @return True if the palette entries can be copied as is, otherwise false
+    template <typename PixelType>
+    bool is_indexed() const {
+        return valid() && compression() == asset_compression::rle &&
+               format() == helpers::asset_pixel_traits<PixelType>::format &&
+               bit_depth() == PixelType::bit_depth &&
+               (index_bit_depth() == 4 || index_bit_depth() == 8);
+    }
+};
+}  // namespace uix
+#endif  // HTCW_UIX_ASSET_HPP
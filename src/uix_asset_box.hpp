@@ -0,0 +1,280 @@
+#ifndef HTCW_UIX_ASSET_BOX_HPP
+#define HTCW_UIX_ASSET_BOX_HPP
+#include "uix_core.hpp"
+#include "uix_asset.hpp"
+namespace uix {
+    namespace helpers {
+        // copies rows of native pixels to a destination
+        template<typename Destination, bool BltSpans>
+        struct asset_blitter {
+            static void blit(Destination& destination, const native_asset& asset, const srect16& rect) {
+                using pixel_type = typename Destination::pixel_type;
+                using palette_type = typename Destination::palette_type;
+                using bitmap_type = gfx::const_bitmap<pixel_type,palette_type>;
+                const size16 dim = asset.dimensions();
+                if(asset.stride()==gfx::bitmap<pixel_type,palette_type>::sizeof_buffer(size16(dim.width,1)) && ((size_t)dim.width*pixel_type::bit_depth)%8==0) {
+                    // rows are contiguous, so the whole asset is a bitmap
+                    const bitmap_type bmp(dim,asset.begin(),destination.palette());
+                    gfx::draw::bitmap(destination,rect,bmp,(rect16)rect);
+                    return;
+                }
+                for(int16_t y = rect.y1;y<=rect.y2;++y) {
+                    const bitmap_type bmp(size16(dim.width,1),asset.row(y),destination.palette());
+                    gfx::draw::bitmap(destination,srect16(rect.x1,y,rect.x2,y),bmp,rect16(rect.x1,0,rect.x2,0));
+                }
+            }
+        };
+        template<typename Destination>
+        struct asset_blitter<Destination,true> {
+            static void blit(Destination& destination, const native_asset& asset, const srect16& rect) {
+                constexpr static const size_t pixel_size = Destination::pixel_type::byte_alignment;
+                const size_t length = (size_t)rect.width()*pixel_size;
+                for(int16_t y = rect.y1;y<=rect.y2;++y) {
+                    gfx::gfx_span row = destination.span(point16(rect.x1,y));
+                    if(row.data==nullptr) {
+                        continue;
+                    }
+                    memcpy(row.data,asset.row(y)+rect.x1*pixel_size,length<row.length?length:row.length);
+                }
+            }
+        };
+        // walks the packets of a run length encoded row, reporting only what falls between x1 and x2
+        template<typename Sink>
+        void asset_rle_row(const native_asset& asset, uint16_t y, int16_t x1, int16_t x2, Sink& sink) {
+            const uint8_t* p = asset.row(y);
+            const bool nibbles = asset.index_bit_depth()==4;
+            const int16_t w = asset.dimensions().width;
+            int16_t x = 0;
+            while(x<=x2 && x<w) {
+                const uint8_t c = *p++;
+                const int16_t n = (c&0x7F)+1;
+                const int16_t first = x<x1?x1:x;
+                const int16_t last = x+n-1>x2?x2:x+n-1;
+                if(c&0x80) {
+                    if(first<=last) {
+                        sink.run(first,last,*p);
+                    }
+                    ++p;
+                } else {
+                    for(int16_t i = first;i<=last;++i) {
+                        const int16_t j = i-x;
+                        sink.run(i,i,nibbles?((p[j>>1]>>((j&1)?0:4))&0x0F):p[j]);
+                    }
+                    p+=nibbles?((n+1)>>1):n;
+                }
+                x+=n;
+            }
+        }
+        // decodes run length encoded rows straight to a destination
+        template<typename Destination, bool BltSpans>
+        struct asset_rle_blitter {
+            using pixel_type = typename Destination::pixel_type;
+            struct sink {
+                Destination* destination;
+                const uint8_t* palette;
+                int16_t y;
+                void run(int16_t x1, int16_t x2, uint8_t index) {
+                    constexpr static const size_t entry_size = (pixel_type::bit_depth+7)/8;
+                    const uint8_t* e = palette+index*entry_size;
+                    pixel_type px;
+                    typename pixel_type::int_type v = 0;
+                    for(size_t i = 0;i<entry_size;++i) {
+                        v = (v<<8) | e[i];
+                    }
+                    px.native_value = v;
+                    destination->fill(rect16(x1,y,x2,y),px);
+                }
+            };
+            static void blit(Destination& destination, const native_asset& asset, const srect16& rect) {
+                sink s {&destination,asset.palette(),0};
+                for(s.y = rect.y1;s.y<=rect.y2;++s.y) {
+                    asset_rle_row(asset,s.y,rect.x1,rect.x2,s);
+                }
+            }
+        };
+        template<typename Destination>
+        struct asset_rle_blitter<Destination,true> {
+            constexpr static const size_t pixel_size = Destination::pixel_type::byte_alignment;
+            struct sink {
+                uint8_t* data;
+                size_t length;
+                const uint8_t* palette;
+                int16_t x;
+                void run(int16_t x1, int16_t x2, uint8_t index) {
+                    const uint8_t* e = palette+index*pixel_size;
+                    size_t o = (x1-x)*pixel_size;
+                    const size_t end = (x2-x+1)*pixel_size;
+                    for(;o<end && o<length;o+=pixel_size) {
+                        memcpy(data+o,e,pixel_size);
+                    }
+                }
+            };
+            static void blit(Destination& destination, const native_asset& asset, const srect16& rect) {
+                for(int16_t y = rect.y1;y<=rect.y2;++y) {
+                    gfx::gfx_span row = destination.span(point16(rect.x1,y));
+                    if(row.data==nullptr) {
+                        continue;
+                    }
+                    sink s {row.data,row.length,asset.palette(),rect.x1};
+                    asset_rle_row(asset,y,rect.x1,rect.x2,s);
+                }
+            }
+        };
+        // paints an alpha asset in a color
+        template<typename Destination, size_t BitDepth>
+        void asset_paint_alpha(Destination& destination, const native_asset& asset, const srect16& rect, gfx::rgba_pixel<32> color) {
+            using bitmap_type = gfx::const_bitmap<gfx::alpha_pixel<BitDepth>>;
+            const size16 dim = asset.dimensions();
+            if(((size_t)dim.width*BitDepth)%8==0) {
+                // rows are contiguous, so the whole asset is a bitmap
+                const bitmap_type bmp(dim,asset.begin());
+                gfx::draw::icon(destination,spoint16::zero(),bmp,color,gfx::rgba_pixel<32>(0,0,0,255),true,false,&rect);
+                return;
+            }
+            for(int16_t y = rect.y1;y<=rect.y2;++y) {
+                const bitmap_type bmp(size16(dim.width,1),asset.row(y));
+                const srect16 r(rect.x1,y,rect.x2,y);
+                gfx::draw::icon(destination,spoint16(0,y),bmp,color,gfx::rgba_pixel<32>(0,0,0,255),true,false,&r);
+            }
+        }
+        template<typename Destination>
+        void asset_paint_alpha(Destination& destination, const native_asset& asset, const srect16& rect, gfx::rgba_pixel<32> color) {
+            switch(asset.bit_depth()) {
+                case 1:
+                    asset_paint_alpha<Destination,1>(destination,asset,rect,color);
+                    break;
+                case 2:
+                    asset_paint_alpha<Destination,2>(destination,asset,rect,color);
+                    break;
+                case 4:
+                    asset_paint_alpha<Destination,4>(destination,asset,rect,color);
+                    break;
+                default:
+                    asset_paint_alpha<Destination,8>(destination,asset,rect,color);
+                    break;
+            }
+        }
+        // indicates whether an asset is coverage that can be painted in any color
+        inline bool asset_is_alpha(const native_asset& asset) {
+            const uint8_t bd = asset.bit_depth();
+            return asset.valid() && asset.format()==asset_format::alpha && asset.compression()==asset_compression::none &&
+                (bd==1 || bd==2 || bd==4 || bd==8);
+        }
+    }
+    /// @brief Represents a control that displays an image asset in the native format of the screen.
+    /// The pixels are copied straight from the asset, with no decoding and no copy in RAM. Run length encoded
+    /// assets are expanded directly into the destination, only for the rows and columns inside the clip. Alpha assets,
+    /// such as text and shapes baked with uix_bake.py, are painted in color().
+    /// @tparam ControlSurfaceType The type of control surface, usually from the screen
+    template<typename ControlSurfaceType> class asset_box : public control<ControlSurfaceType> {
+    public:
+        using type = asset_box;
+        using base_type = control<ControlSurfaceType>;
+        using pixel_type = typename ControlSurfaceType::pixel_type;
+        using palette_type = typename ControlSurfaceType::palette_type;
+        using control_surface_type = ControlSurfaceType;
+    private:
+        native_asset m_asset;
+        gfx::rgba_pixel<32> m_color;
+        using blitter_type = helpers::asset_blitter<control_surface_type,control_surface_type::caps::blt_spans && (pixel_type::bit_depth%8)==0>;
+        using rle_blitter_type = helpers::asset_rle_blitter<control_surface_type,control_surface_type::caps::blt_spans && (pixel_type::bit_depth%8)==0>;
+    protected:
+        void do_move_control(asset_box& rhs) {
+            this->base_type::do_move_control(rhs);
+            m_asset = rhs.m_asset;
+            rhs.m_asset = native_asset();
+            m_color = rhs.m_color;
+        }
+        void do_copy_control(const asset_box& rhs) {
+            this->base_type::do_copy_control(rhs);
+            m_asset = rhs.m_asset;
+            m_color = rhs.m_color;
+        }
+    public:
+        /// @brief Moves an asset_box
+        /// @param rhs The asset_box to move
+        asset_box(asset_box&& rhs) {
+            do_move_control(rhs);
+        }
+        /// @brief Moves an asset_box
+        /// @param rhs The asset_box to move
+        /// @return This
+        asset_box& operator=(asset_box&& rhs) {
+            do_move_control(rhs);
+            return *this;
+        }
+        /// @brief Copies an asset_box
+        /// @param rhs The asset_box to copy
+        asset_box(const asset_box& rhs) {
+            do_copy_control(rhs);
+        }
+        /// @brief Copies an asset_box
+        /// @param rhs The asset_box to copy
+        /// @return this
+        asset_box& operator=(const asset_box& rhs) {
+            do_copy_control(rhs);
+            return *this;
+        }
+        /// @brief Constructs an asset_box with the given parent and optional palette
+        /// @param parent The parent - usually a screen
+        /// @param palette The associated palette, usually from the screen
+        asset_box(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent,palette), m_color(0xFF,0xFF,0xFF,0xFF) {
+        }
+        /// @brief Constructs an asset_box
+        asset_box() : base_type(), m_color(0xFF,0xFF,0xFF,0xFF) {
+        }
+        /// @brief Indicates the asset being displayed
+        /// @return A pointer to the asset data, or null if none
+        const uint8_t* asset() const {
+            return m_asset.data();
+        }
+        /// @brief Sets the asset to display
+        /// @param data The asset data, including its header. It is not copied, so it must remain valid, such as a const array in flash.
+        /// @param invalidate True to redraw the control
+        /// @return The result of the operation. The asset must hold pixels or a palette in the screen's pixel type, or uncompressed alpha.
+        uix_result asset(const uint8_t* data, bool invalidate = true) {
+            native_asset a(data);
+            if(data==nullptr || !(a.template is_native<pixel_type>() || a.template is_indexed<pixel_type>() || helpers::asset_is_alpha(a))) {
+                return uix_result::invalid_argument;
+            }
+            m_asset = a;
+            if(invalidate) {
+                this->invalidate();
+            }
+            return uix_result::success;
+        }
+        /// @brief Indicates the color alpha assets are painted in
+        /// @return The RGBA8888 color
+        gfx::rgba_pixel<32> color() const {
+            return m_color;
+        }
+        /// @brief Sets the color alpha assets are painted in
+        /// @param value The RGBA8888 color
+        void color(gfx::rgba_pixel<32> value) {
+            m_color = value;
+            if(helpers::asset_is_alpha(m_asset)) {
+                this->invalidate();
+            }
+        }
+        /// @brief Called when the asset_box is painted
+        /// @param destination The destination to paint to
+        /// @param clip The clipping rectangle
+        virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
+            if(!m_asset.valid()) {
+                return;
+            }
+            const srect16 b = (srect16)m_asset.bounds();
+            if(!b.intersects(clip)) {
+                return;
+            }
+            if(m_asset.format()==asset_format::alpha && !m_asset.template is_native<pixel_type>()) {
+                helpers::asset_paint_alpha(destination,m_asset,b.crop(clip),m_color);
+            } else if(m_asset.compression()==asset_compression::rle) {
+                rle_blitter_type::blit(destination,m_asset,b.crop(clip));
+            } else {
+                blitter_type::blit(destination,m_asset,b.crop(clip));
+            }
+        }
+    };
+}
+#endif
@@ -167,6 +167,8 @@ namespace uix {
         const char* m_text;
         gfx::rgba_pixel<32> m_background_color;
         gfx::rgba_pixel<32> m_color;
+        typename base_type::native_color_type m_native_color;
+        typename base_type::native_color_type m_native_background_color;
         bool m_dirty;
         bool m_data[helpers::ean13<false>::size()];
         void recompute() {
@@ -279,12 +281,12 @@ namespace uix {
             bool draw_bg = false;
             pixel_type px;
             if(m_background_color.opacity()>0.f) {
-                if(gfx::gfx_result::success!=gfx::convert_palette_from(destination,m_background_color,&bgpx)) {
+                if(gfx::gfx_result::success!=m_native_background_color.get(destination,m_background_color,&bgpx)) {
                     return;
                 }
                 draw_bg=true;
             }
-            if(gfx::gfx_result::success!=gfx::convert_palette_from(destination,m_color,&px)) {
+            if(gfx::gfx_result::success!=m_native_color.get(destination,m_color,&px)) {
                 return;
             }
             const int sz = helpers::ean13<false>::size()<destination.dimensions().width?(int)helpers::ean13<false>::size():(int)destination.dimensions().width;
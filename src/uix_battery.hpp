@@ -8,6 +8,8 @@ class battery : public control<ControlSurfaceType> {
     constexpr static const gfx::rgba_pixel<32> color_white = gfx::rgba_pixel<32>(255, 255, 255, 255);
     gfx::rgba_pixel<32> m_inner_color;
     gfx::rgba_pixel<32> m_color;
+    typename base_type::native_color_type m_native_color;
+    typename base_type::native_color_type m_native_inner_color;
     bool m_dirty;
     bool m_skip_inner;
     uint8_t m_level;
@@ -21,7 +23,27 @@ class battery : public control<ControlSurfaceType> {
     static constexpr gfx::srect16 s_v_inner=gfx::srect16(192, 64, 370, 480);
     gfx::spoint16 m_points[s_outer_size];
     gfx::srect16 m_inner;
+    gfx::srect16 m_interior;
     bool m_vertical;
+    // sizes the fill to the level within the interior
+    void fill_level() {
+        m_inner = m_interior;
+        m_skip_inner = (m_level == 0);
+        if (m_level > 0) {
+            if (!m_vertical) {
+                int fw = ((m_interior.x2 - m_interior.x1 + 1) * m_level) / 100;
+                if (fw <= 0) {
+                    m_skip_inner=true;
+                } else {
+                    m_inner = srect16(m_interior.x1, m_interior.y1, m_interior.x1 + fw - 1, m_interior.y2);
+                }
+            } else {
+                int fh = ((m_interior.y2 - m_interior.y1 + 1) * m_level) / 100;
+                if (fh <= 0) m_skip_inner = true;
+                else m_inner = srect16(m_interior.x1, m_interior.y2 - fh + 1, m_interior.x2, m_interior.y2);
+            }
+        }
+    }
     static void scale_and_center_points(spoint16* path, size_t path_size, int divisor,
                                         int src_cx, int src_cy,
                                         int dst_cx, int dst_cy) {
@@ -65,7 +87,7 @@ class battery : public control<ControlSurfaceType> {
     /// @param parent The parent screen
     /// @param palette The palette, if any
     battery(uix::invalidation_tracker& parent, const palette_type* palette = nullptr)
-        : base_type(parent, palette), m_level(nullptr), m_dirty(true),m_skip_inner(false),m_level(0) {
+        : base_type(parent, palette), m_dirty(true),m_skip_inner(false),m_level(0) {
         m_color = color_white;
         m_inner_color = color_white;
     }
@@ -101,8 +123,37 @@ class battery : public control<ControlSurfaceType> {
     /// @brief Sets the m_level of the battery
     /// @param value The level in percent from 0 to 100
     void level(uint8_t value) {
+        if (value == m_level) {
+            return;
+        }
+        if (m_dirty) {
+            m_level = value;
+            this->invalidate();
+            return;
+        }
+        // only the part of the fill between the old and new levels changes
+        const srect16 old_fill = m_inner;
+        const bool old_skip = m_skip_inner;
         m_level = value;
-        this->invalidate();
+        fill_level();
+        if (old_skip || m_skip_inner) {
+            if (!old_skip) {
+                this->invalidate(old_fill);
+            }
+            if (!m_skip_inner) {
+                this->invalidate(m_inner);
+            }
+            return;
+        }
+        if (!m_vertical) {
+            const int16_t x1 = (old_fill.x2 < m_inner.x2 ? old_fill.x2 : m_inner.x2) + 1;
+            const int16_t x2 = old_fill.x2 < m_inner.x2 ? m_inner.x2 : old_fill.x2;
+            this->invalidate(srect16(x1, m_interior.y1, x2, m_interior.y2));
+        } else {
+            const int16_t y1 = old_fill.y1 < m_inner.y1 ? old_fill.y1 : m_inner.y1;
+            const int16_t y2 = (old_fill.y1 < m_inner.y1 ? m_inner.y1 : old_fill.y1) - 1;
+            this->invalidate(srect16(m_interior.x1, y1, m_interior.x2, y2));
+        }
     }
     /// @brief Indicates the color of the qrcode
     /// @return The RGBA8888 color
@@ -165,20 +216,8 @@ class battery : public control<ControlSurfaceType> {
             const int dcx = b.x1 + (bw - 1) / 2, dcy = b.y1 + (bh - 1) / 2;
             scale_and_center_points(m_points, s_outer_size, div, 288, 256, dcx, dcy);
             scale_and_center_points(m_inner, div, 288, 256, dcx, dcy);
-            if (m_level > 0) {
-                if (!m_vertical) {
-                    int fw = ((m_inner.x2 - m_inner.x1 + 1) * m_level) / 100;
-                    if (fw <= 0) {
-                        m_skip_inner=true;
-                    } else {
-                        m_inner = srect16(m_inner.x1, m_inner.y1, m_inner.x1 + fw - 1, m_inner.y2);
-                    }
-                } else {
-                    int fh = ((m_inner.y2 - m_inner.y1 + 1) * m_level) / 100;
-                    if (fh <= 0) m_skip_inner = true;
-                    else m_inner = srect16(m_inner.x1, m_inner.y2 - fh + 1, m_inner.x2, m_inner.y2);
-                }
-            }
+            m_interior = m_inner;
+            fill_level();
             m_dirty = false;
         }
     }
@@ -191,11 +230,19 @@ class battery : public control<ControlSurfaceType> {
             return;
         }
         gfx::spath16 path(s_outer_size,m_points);
-        gfx::draw::aa_filled_polygon(destination, path, m_color);;
-    
+        // opaque colors are drawn as native pixels, converted once rather than every paint
+        pixel_type px;
+        if (m_color.opacity() == 1.f && gfx::gfx_result::success == m_native_color.get(destination, m_color, &px)) {
+            gfx::draw::aa_filled_polygon(destination, path, px);
+        } else {
+            gfx::draw::aa_filled_polygon(destination, path, m_color);
+        }
         if (!m_skip_inner) {
-            gfx::draw::filled_rectangle(destination, m_inner, m_inner_color);
-        
+            if (m_inner_color.opacity() == 1.f && gfx::gfx_result::success == m_native_inner_color.get(destination, m_inner_color, &px)) {
+                gfx::draw::filled_rectangle(destination, m_inner, px);
+            } else {
+                gfx::draw::filled_rectangle(destination, m_inner, m_inner_color);
+            }
         }
     }
 };
@@ -3,10 +3,250 @@
 #include "uix_core.hpp"
 #include "gfx_draw_canvas.hpp"
 namespace uix {
+namespace helpers {
+/// @brief A draw target that passes drawing on to another draw target, dropping whatever falls outside a region at its top left.
+/// Pooled canvases may be larger than what they are drawing, so they are bound through this.
+/// @tparam Destination The type of the draw target to forward to
+template <typename Destination>
+class clipped_target final {
+   public:
+    using type = clipped_target;
+    using pixel_type = typename Destination::pixel_type;
+    using palette_type = typename Destination::palette_type;
+    using caps = gfx::gfx_caps<false, false, false, false>;
+
+   private:
+    Destination& m_destination;
+    size16 m_dimensions;
+
+   public:
+    /// @brief Constructs a new target
+    /// @param destination The draw target to forward to
+    /// @param dimensions The size of the region at the top left that is drawn
+    clipped_target(Destination& destination, size16 dimensions) : m_destination(destination), m_dimensions(dimensions) {
+    }
+    /// @brief Retrieves the palette, if any
+    /// @return The palette
+    const palette_type* palette() const {
+        return m_destination.palette();
+    }
+    /// @brief Reports the size of the region that is drawn
+    /// @return a size16 with the width and height
+    size16 dimensions() const {
+        return m_dimensions;
+    }
+    /// @brief Reports the bounds of the region that is drawn
+    /// @return a rect16 anchored to (0,0)
+    rect16 bounds() const {
+        return rect16(point16::zero(), m_dimensions);
+    }
+    /// @brief Reports the color of the pixel at a location
+    /// @param location The location to check
+    /// @param out_pixel A pointer to the pixel data to fill
+    /// @return The result of the operation
+    gfx::gfx_result point(point16 location, pixel_type* out_pixel) const {
+        if (location.x >= m_dimensions.width || location.y >= m_dimensions.height) {
+            return gfx::gfx_result::out_of_bounds;
+        }
+        return m_destination.point(location, out_pixel);
+    }
+    /// @brief Sets the color of a pixel, if the location is in the region
+    /// @param location The location
+    /// @param pixel The new color
+    /// @return The result of the operation
+    gfx::gfx_result point(point16 location, pixel_type pixel) {
+        if (location.x >= m_dimensions.width || location.y >= m_dimensions.height) {
+            return gfx::gfx_result::success;
+        }
+        return m_destination.point(location, pixel);
+    }
+    /// @brief Fills the part of a rectangular region that is within the region with a color
+    /// @param bounds The rect16 coordinates to fill
+    /// @param pixel The new color
+    /// @return The result of the operation
+    gfx::gfx_result fill(const rect16& bounds, pixel_type pixel) {
+        const rect16 b = bounds.normalize();
+        if (!b.intersects(this->bounds())) {
+            return gfx::gfx_result::success;
+        }
+        return m_destination.fill(b.crop(this->bounds()), pixel);
+    }
+    /// @brief Clears the part of a rectangular region that is within the region, setting it to the default color
+    /// @param bounds The rect16 coordinates to clear
+    /// @return The result of the operation
+    gfx::gfx_result clear(const rect16& bounds) {
+        return fill(bounds, pixel_type());
+    }
+};
+}  // namespace helpers
+/// @brief A pool of initialized vector canvases shared between canvas controls.
+/// Controls borrow a canvas at least their size for the duration of a paint,
+/// and draw to its top left. When no canvas is large enough, one is grown to
+/// cover both its old size and the new one, so the pool settles on a few
+/// canvases that fit every control, rather than re-initializing canvases as
+/// differently sized controls take turns. The rasterizer memory scales with
+/// the largest controls (up to the capacity) rather than with the number of
+/// controls or sizes.
+class canvas_pool final {
+   public:
+    /// @brief The maximum number of canvases a pool can hold
+    constexpr static const size_t max_capacity = 8;
+
+   private:
+    struct entry {
+        gfx::canvas canvas;
+        gfx::canvas_style style;
+        uint32_t age;
+        bool busy;
+    };
+    entry m_entries[max_capacity];
+    size_t m_capacity;
+    uint32_t m_age;
+    canvas_pool(const canvas_pool& rhs) = delete;
+    canvas_pool& operator=(const canvas_pool& rhs) = delete;
+    canvas_pool(canvas_pool&& rhs) = delete;
+    canvas_pool& operator=(canvas_pool&& rhs) = delete;
+    static void reset(entry& e) {
+        if (e.canvas.initialized()) {
+            e.canvas.deinitialize();
+        }
+        e.canvas.dimensions(size16(0, 0));
+        e.age = 0;
+    }
+
+   public:
+    /// @brief Constructs a new pool
+    /// @param capacity The number of canvases to keep initialized
+    canvas_pool(size_t capacity = 4) : m_capacity(capacity > max_capacity ? max_capacity : capacity), m_age(0) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            m_entries[i].age = 0;
+            m_entries[i].busy = false;
+        }
+    }
+    /// @brief Destroys the pool
+    ~canvas_pool() {
+        clear();
+    }
+    /// @brief Indicates the number of canvases kept initialized
+    /// @return The capacity
+    size_t capacity() const {
+        return m_capacity;
+    }
+    /// @brief Sets the number of canvases kept initialized
+    /// @param value The capacity, up to max_capacity
+    void capacity(size_t value) {
+        if (value > max_capacity) {
+            value = max_capacity;
+        }
+        for (size_t i = value; i < m_capacity; ++i) {
+            if (!m_entries[i].busy) {
+                reset(m_entries[i]);
+            }
+        }
+        m_capacity = value;
+    }
+    /// @brief Borrows an initialized canvas at least as large as asked for, with its transform and style in their initial state.
+    /// Draw to its top left, through a helpers::clipped_target of the size asked for, and don't rely on its bounds.
+    /// @param dimensions The size that will be drawn
+    /// @return The canvas, or null if one could not be initialized
+    gfx::canvas* acquire(size16 dimensions) {
+        entry* hit = nullptr;
+        entry* victim = nullptr;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (e.busy) continue;
+            if (e.canvas.initialized()) {
+                const size16 d = e.canvas.dimensions();
+                if (d.width >= dimensions.width && d.height >= dimensions.height) {
+                    // the smallest that covers it
+                    if (hit == nullptr || (uint32_t)d.width * d.height < (uint32_t)hit->canvas.dimensions().width * hit->canvas.dimensions().height) {
+                        hit = &e;
+                    }
+                    continue;
+                }
+            }
+            // prefer an empty entry, otherwise the least recently used
+            if (victim == nullptr ||
+                (victim->canvas.initialized() && (!e.canvas.initialized() || e.age < victim->age))) {
+                victim = &e;
+            }
+        }
+        if (hit == nullptr) {
+            if (victim == nullptr) {
+                return nullptr;
+            }
+            // grow it to cover what it held as well, so the sizes don't keep trading places
+            size16 grown = dimensions;
+            if (victim->canvas.initialized()) {
+                const size16 d = victim->canvas.dimensions();
+                if (d.width > grown.width) grown.width = d.width;
+                if (d.height > grown.height) grown.height = d.height;
+            }
+            reset(*victim);
+            victim->canvas.dimensions(grown);
+            if (gfx::gfx_result::success != victim->canvas.initialize()) {
+                reset(*victim);
+                if (grown.width == dimensions.width && grown.height == dimensions.height) {
+                    return nullptr;
+                }
+                // not enough memory to grow, so settle for the size asked for
+                victim->canvas.dimensions(dimensions);
+                if (gfx::gfx_result::success != victim->canvas.initialize()) {
+                    reset(*victim);
+                    return nullptr;
+                }
+            }
+            victim->style = victim->canvas.style();
+            hit = victim;
+        } else {
+            // undo whatever the last borrower left behind
+            hit->canvas.transform(gfx::matrix::create_identity());
+            hit->canvas.style(hit->style);
+        }
+        hit->busy = true;
+        hit->age = ++m_age;
+        return &hit->canvas;
+    }
+    /// @brief Returns a canvas borrowed with acquire()
+    /// @param canvas The canvas
+    void release(gfx::canvas* canvas) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (&e.canvas == canvas) {
+                e.busy = false;
+                if (i >= m_capacity) {
+                    reset(e);
+                }
+                return;
+            }
+        }
+    }
+    /// @brief Deinitializes every canvas not currently borrowed
+    void clear() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (!m_entries[i].busy) {
+                reset(m_entries[i]);
+            }
+        }
+    }
+};
+namespace helpers {
+template <bool Dummy>
+struct canvas_pool_shared {
+    static canvas_pool pool;
+};
+template <bool Dummy>
+canvas_pool canvas_pool_shared<Dummy>::pool;
+}  // namespace helpers
+/// @brief Retrieves the canvas pool used by canvas controls unless told otherwise
+/// @return The shared pool
+inline canvas_pool& default_canvas_pool() {
+    return helpers::canvas_pool_shared<true>::pool;
+}
 template<typename ControlSurfaceType>
 class canvas_control : public control<ControlSurfaceType> {
     using base_type = control<ControlSurfaceType>;
-    gfx::canvas m_canvas;
+    canvas_pool* m_pool;
    public:
     using type = canvas_control;
     using pixel_type = typename ControlSurfaceType::pixel_type;
@@ -23,42 +263,50 @@ protected:
     /// @param destination The destination to draw to
     /// @param clip The clipping rectangle
     virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
-        m_canvas.initialize();
-        gfx::draw::canvas(destination,m_canvas,point16::zero(),nullptr);
-        on_paint(m_canvas,clip);
+        gfx::canvas* cvs = m_pool->acquire((size16)this->dimensions());
+        if (cvs == nullptr) {
+            return;
+        }
+        // the canvas stays initialized, but is bound to this tile's surface. It may be larger than the control, so clip to the control
+        helpers::clipped_target<control_surface_type> target(destination,(size16)this->dimensions());
+        gfx::draw::canvas(target,*cvs,point16::zero(),nullptr);
+        on_paint(*cvs,clip);
+        m_pool->release(cvs);
         // for diag purposes:
         // draw::rectangle(destination,destination.bounds(),rgb_pixel<16>(0,0,0));
     }
     /// @brief Copies the control
     /// @param value The control to copy
     void do_copy_control(const canvas_control& value) {
-        base_type::on_copy_control(value);
-        m_canvas.deinitialize();
-        m_canvas.dimensions(size16(value.width(),value.height()));
+        base_type::do_copy_control(value);
+        m_pool = value.m_pool;
     }
     /// @brief Moves the control
     /// @param value The control to move
     void do_move_control(canvas_control& value) {
-        base_type::on_copy_control(value);
-        m_canvas.deinitialize();
-        m_canvas.dimensions(size16(value.width(),value.height()));
-        value.m_canvas.deinitialize();
+        base_type::do_move_control(value);
+        m_pool = value.m_pool;
     }
 public:
     /// @brief Constructs an empty control instance
-    canvas_control() : base_type() {
+    canvas_control() : base_type(), m_pool(&default_canvas_pool()) {
     }
     /// @brief Constructs a control given a parent and an optional palette
     /// @param parent The parent invalidation tracker - usually a screen
     /// @param palette The palette. Typically the screen's palette()
-    canvas_control(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent,palette) {
-        
+    canvas_control(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent,palette), m_pool(&default_canvas_pool()) {
+
+    }
+    /// @brief Indicates the pool the control borrows its canvas from
+    /// @return The canvas pool
+    canvas_pool& pool() const {
+        return *m_pool;
     }
-    
-    virtual void on_after_resize() override {
-        m_canvas.deinitialize();
-        m_canvas.dimensions(size16(this->bounds().width(),this->bounds().height()));
+    /// @brief Sets the pool the control borrows its canvas from
+    /// @param value The canvas pool
+    void pool(canvas_pool& value) {
+        m_pool = &value;
     }
 };
 }
-#endif
\ No newline at end of file
+#endif
@@ -328,6 +328,49 @@ class control_surface final : public helpers::control_surface_impl<BitmapType, B
     control_surface(bitmap_type& bmp, const srect16& rect, spoint16 offset) : base_type(bmp, rect, offset) {
     }
 };
+/// @brief Holds a color converted to a native pixel, and converts it again only when the color or the destination's palette changes.
+/// Converting to an indexed pixel searches the palette for the nearest color, so this keeps that search out of every paint.
+/// @tparam PixelType The native pixel type
+/// @tparam PaletteType The palette type
+template <typename PixelType, typename PaletteType>
+class native_color final {
+    gfx::rgba_pixel<32> m_source;
+    const PaletteType* m_palette;
+    PixelType m_native;
+    bool m_valid;
+
+   public:
+    /// @brief Constructs an empty cache
+    native_color() : m_palette(nullptr), m_valid(false) {
+    }
+    /// @brief Forgets the converted color
+    void reset() {
+        m_valid = false;
+    }
+    /// @brief Retrieves a color in the native format of a destination
+    /// @tparam Destination The type of the draw destination
+    /// @param destination The destination, which provides the palette, if any
+    /// @param color The color to convert
+    /// @param out_pixel Receives the native pixel
+    /// @return The result of the operation
+    template <typename Destination>
+    gfx::gfx_result get(const Destination& destination, gfx::rgba_pixel<32> color, PixelType* out_pixel) {
+        if (!m_valid || m_source.native_value != color.native_value || m_palette != destination.palette()) {
+            const gfx::gfx_result r = gfx::convert_palette_from(destination, color, &m_native);
+            if (r != gfx::gfx_result::success) {
+                m_valid = false;
+                return r;
+            }
+            m_source = color;
+            m_palette = destination.palette();
+            m_valid = true;
+        }
+        *out_pixel = m_native;
+        return gfx::gfx_result::success;
+    }
+};
+class image_cache;
+class glyph_atlas;
 /// @brief Tracks dirty rectangles
 class invalidation_tracker {
    public:
@@ -338,6 +381,25 @@ class invalidation_tracker {
     /// @brief Marks all dirty rectangles as clean
     /// @return The result of the operation
     virtual uix_result validate_all() = 0;
+    /// @brief Indicates whether the tracker collects control invalidations before it renders rather than taking them as they happen.
+    /// Only controls that have been told to defer_invalidation(true), which the tracker does for the controls it collects from, hold them.
+    /// @return True if controls may hold their invalidations until they are collected, otherwise false
+    virtual bool defers_invalidation() const {
+        return false;
+    }
+    /// @brief Called by a control after it starts holding an invalidation, so the tracker knows to call flush_invalidation() on its controls
+    virtual void control_invalidation_held() {
+    }
+    /// @brief Indicates the cache controls keep decoded images in across frames
+    /// @return The image cache, or null if there is none
+    virtual image_cache* decoded_image_cache() const {
+        return nullptr;
+    }
+    /// @brief Indicates the atlas text controls share rasterized glyphs through
+    /// @return The glyph atlas, or null if there is none
+    virtual glyph_atlas* text_glyph_atlas() const {
+        return nullptr;
+    }
 };
 /// @brief Represents the base type for all controls
 /// @tparam ControlSurfaceType The type of control_surface to use. Usually this comes from the screen<>.
@@ -348,21 +410,79 @@ class control {
     using pixel_type = typename ControlSurfaceType::pixel_type;
     using palette_type = typename ControlSurfaceType::palette_type;
     using control_surface_type = ControlSurfaceType;
+    /// @brief The type used to keep a color converted to the native pixel format
+    using native_color_type = native_color<pixel_type, palette_type>;
 
    private:
     srect16 m_bounds;
     const palette_type* m_palette;
     bool m_visible;
+    bool m_interlaced;
     invalidation_tracker* m_parent;
+    // the most separate areas a control holds before it has to merge two of them
+    static constexpr const size_t max_held_rects = 4;
+    bool m_defer_invalidation;
+    uint8_t m_invalid_count;
+    srect16 m_invalid_rects[max_held_rects];
+    // how much more a merged rect covers than the two rects do separately
+    static int32_t merge_growth(const srect16& lhs, const srect16& rhs) {
+        const srect16 u = lhs.merge(rhs);
+        return (int32_t)u.width() * u.height() - ((int32_t)lhs.width() * lhs.height() + (int32_t)rhs.width() * rhs.height());
+    }
+    // holds the rect, in parent coordinates, until the parent collects it, if the parent allows
+    uix_result invalidate_parent(const srect16& rect) {
+        if (!m_defer_invalidation || !m_parent->defers_invalidation()) {
+            return m_parent->invalidate(rect);
+        }
+        for (size_t i = 0; i < m_invalid_count; ++i) {
+            if (merge_growth(m_invalid_rects[i], rect) <= 0) {
+                m_invalid_rects[i] = m_invalid_rects[i].merge(rect);
+                return uix_result::success;
+            }
+        }
+        if (m_invalid_count == 0) {
+            m_parent->control_invalidation_held();
+        }
+        if (m_invalid_count < max_held_rects) {
+            m_invalid_rects[m_invalid_count++] = rect;
+            return uix_result::success;
+        }
+        // full, so merge whichever two of the held rects and the new one grow the least
+        size_t first = 0, second = max_held_rects;
+        int32_t least = merge_growth(m_invalid_rects[0], rect);
+        for (size_t i = 0; i < max_held_rects; ++i) {
+            const int32_t g = merge_growth(m_invalid_rects[i], rect);
+            if (g < least) {
+                least = g;
+                first = i;
+                second = max_held_rects;
+            }
+            for (size_t j = i + 1; j < max_held_rects; ++j) {
+                const int32_t pg = merge_growth(m_invalid_rects[i], m_invalid_rects[j]);
+                if (pg < least) {
+                    least = pg;
+                    first = i;
+                    second = j;
+                }
+            }
+        }
+        if (second == max_held_rects) {
+            m_invalid_rects[first] = m_invalid_rects[first].merge(rect);
+        } else {
+            m_invalid_rects[first] = m_invalid_rects[first].merge(m_invalid_rects[second]);
+            m_invalid_rects[second] = rect;
+        }
+        return uix_result::success;
+    }
 
    protected:
     /// @brief Constructs an empty control instance
-    control() : m_bounds({0, 0, 49, 24}), m_palette(nullptr), m_visible(true), m_parent(nullptr) {
+    control() : m_bounds({0, 0, 49, 24}), m_palette(nullptr), m_visible(true), m_interlaced(false), m_parent(nullptr), m_defer_invalidation(false), m_invalid_count(0) {
     }
     /// @brief Constructs a control given a parent and an optional palette
     /// @param parent The parent invalidation tracker - usually a screen
     /// @param palette The palette. Typically the screen's palette()
-    control(invalidation_tracker& parent, const palette_type* palette = nullptr) : m_bounds({0, 0, 49, 24}), m_palette(palette), m_visible(true), m_parent(&parent) {
+    control(invalidation_tracker& parent, const palette_type* palette = nullptr) : m_bounds({0, 0, 49, 24}), m_palette(palette), m_visible(true), m_interlaced(false), m_parent(&parent), m_defer_invalidation(false), m_invalid_count(0) {
     }
     /// @brief Copies a control into this instance
     /// @param rhs The control to copy
@@ -370,15 +490,24 @@ class control {
         m_bounds = rhs.m_bounds;
         m_palette = rhs.m_palette;
         m_visible = rhs.m_visible;
+        m_interlaced = rhs.m_interlaced;
         m_parent = rhs.m_parent;
+        // only the parent's registration turns deferral on, and this copy isn't registered
+        m_defer_invalidation = false;
+        m_invalid_count = 0;
     }
     /// @brief Moves a control into this instance
     /// @param rhs The control to move
     void do_move_control(control& rhs) {
+        // hand over what the source holds, since nothing collects it from here
+        rhs.flush_invalidation();
         m_bounds = rhs.m_bounds;
         m_palette = rhs.m_palette;
         m_visible = rhs.m_visible;
+        m_interlaced = rhs.m_interlaced;
         m_parent = rhs.m_parent;
+        m_defer_invalidation = false;
+        m_invalid_count = 0;
     }
 
    public:
@@ -423,6 +552,16 @@ class control {
     invalidation_tracker& parent() const {
         return *m_parent;
     }
+    /// @brief Indicates the cache decoded images are kept in across frames, which is provided by the parent
+    /// @return The image cache, or null if there is none
+    image_cache* decoded_image_cache() const {
+        return m_parent != nullptr ? m_parent->decoded_image_cache() : nullptr;
+    }
+    /// @brief Indicates the atlas rasterized glyphs are shared through, which is provided by the parent
+    /// @return The glyph atlas, or null if there is none
+    glyph_atlas* text_glyph_atlas() const {
+        return m_parent != nullptr ? m_parent->text_glyph_atlas() : nullptr;
+    }
     /// @brief Indicates the bounds of the control
     /// @return an srect16 indicating the location and size of the control
     srect16 bounds() const {
@@ -485,6 +624,19 @@ class control {
             this->invalidate();
         }
     }
+    /// @brief Indicates whether the control may be updated at half rate when
+    /// the screen is interlacing
+    /// @return True if the control can be interlaced, otherwise false
+    bool interlaced() const {
+        return m_interlaced;
+    }
+    /// @brief Sets whether the control may be updated at half rate when the
+    /// screen is interlacing. Suits full screen animations. Leave it off for
+    /// static controls.
+    /// @param value True if the control can be interlaced, otherwise false
+    void interlaced(bool value) {
+        m_interlaced = value;
+    }
     /// @brief Indicates the parent of the control
     /// @return A reference to the parent
     invalidation_tracker& parent() {
@@ -494,6 +646,7 @@ class control {
     /// @param parent The parent
     void parent(invalidation_tracker& parent) {
         m_parent = &parent;
+        m_invalid_count = 0;
     }
     /// @brief Invalidates the control
     /// @return The result of the operation
@@ -501,7 +654,7 @@ class control {
         if (m_parent == nullptr) {
             return uix_result::invalid_state;
         }
-        return m_parent->invalidate(m_bounds);
+        return invalidate_parent(m_bounds);
     }
     /// @brief Invalidates a rect within the control
     /// @param bounds An srect16 to invalidate in control local coordinates
@@ -513,10 +666,72 @@ class control {
         srect16 b = bounds.offset(this->bounds().location());
         if (b.intersects(this->bounds())) {
             b = b.crop(this->bounds());
-            return m_parent->invalidate(b);
+            return invalidate_parent(b);
+        }
+        return uix_result::success;
+    }
+    /// @brief Invalidates two rects within the control, such as where something was drawn and where it is drawn now.
+    /// They are invalidated as their union when it covers no more than the two do separately, and otherwise one at a time.
+    /// @param first The first srect16 to invalidate in control local coordinates
+    /// @param second The second srect16 to invalidate in control local coordinates
+    /// @return The result of the operation
+    uix_result invalidate(const srect16& first, const srect16& second) {
+        const srect16 u = first.merge(second);
+        const int32_t separate = (int32_t)first.width() * first.height() + (int32_t)second.width() * second.height();
+        if ((int32_t)u.width() * u.height() <= separate) {
+            return invalidate(u);
+        }
+        const uix_result r = invalidate(first);
+        if (r != uix_result::success) {
+            return r;
+        }
+        return invalidate(second);
+    }
+    /// @brief Indicates whether the control holds its invalidations for its parent to collect
+    /// @return True if invalidations are held, otherwise false
+    bool defer_invalidation() const {
+        return m_defer_invalidation;
+    }
+    /// @brief Sets whether the control holds its invalidations for its parent to collect, if the parent defers_invalidation().
+    /// Parents set this on the controls they collect from, such as when a control is registered with a screen.
+    /// @param value True to hold invalidations, or false to pass them on as they happen
+    /// @return The result of the operation
+    uix_result defer_invalidation(bool value) {
+        m_defer_invalidation = value;
+        if (!value) {
+            return flush_invalidation();
         }
         return uix_result::success;
     }
+    /// @brief Indicates whether the control holds an invalidation its parent has yet to collect
+    /// @return True if the control is waiting to be collected, otherwise false
+    bool invalid() const {
+        return m_invalid_count != 0;
+    }
+    /// @brief Passes the invalidations the control holds on to its parent. Called by the parent before it renders.
+    /// @return The result of the operation
+    uix_result flush_invalidation() {
+        if (m_invalid_count == 0) {
+            return uix_result::success;
+        }
+        if (m_parent == nullptr) {
+            return uix_result::invalid_state;
+        }
+        const size_t count = m_invalid_count;
+        m_invalid_count = 0;
+        uix_result res = uix_result::success;
+        for (size_t i = 0; i < count; ++i) {
+            const uix_result r = m_parent->invalidate(m_invalid_rects[i]);
+            if (r != uix_result::success) {
+                res = r;
+            }
+        }
+        return res;
+    }
+    /// @brief Discards the invalidations the control holds
+    void validate() {
+        m_invalid_count = 0;
+    }
 };
 using uix_pixel = gfx::rgba_pixel<32>;
 }  // namespace uix
@@ -0,0 +1,176 @@
+#ifndef HTCW_UIX_GLYPH_ATLAS_HPP
+#define HTCW_UIX_GLYPH_ATLAS_HPP
+#include "uix_core.hpp"
+namespace uix {
+/// @brief A set of glyph caches shared by every control drawing text in the same font, so each glyph is rasterized once
+/// no matter how many labels show it. The glyphs are kept as 8-bit coverage, so they can be drawn in any color.
+/// Fonts are evicted least recently used first to stay within the memory budget.
+class glyph_atlas final {
+   public:
+    /// @brief The maximum number of fonts an atlas can hold
+    constexpr static const size_t max_capacity = 8;
+
+   private:
+    struct entry {
+        const gfx::font* font;
+        gfx::font_draw_cache draw;
+        gfx::font_measure_cache measure;
+        size_t size;
+        uint32_t age;
+    };
+    entry m_entries[max_capacity];
+    size_t m_budget;
+    size_t m_used;
+    uint16_t m_glyphs_per_font;
+    uint32_t m_age;
+    glyph_atlas(const glyph_atlas& rhs) = delete;
+    glyph_atlas& operator=(const glyph_atlas& rhs) = delete;
+    glyph_atlas(glyph_atlas&& rhs) = delete;
+    glyph_atlas& operator=(glyph_atlas&& rhs) = delete;
+    void free_entry(entry& e) {
+        if (e.font != nullptr) {
+            e.draw.deinitialize();
+            e.measure.deinitialize();
+            m_used -= e.size;
+            e.size = 0;
+            e.font = nullptr;
+        }
+    }
+    bool evict_one() {
+        entry* victim = nullptr;
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (e.font != nullptr && (victim == nullptr || e.age < victim->age)) {
+                victim = &e;
+            }
+        }
+        if (victim == nullptr) {
+            return false;
+        }
+        free_entry(*victim);
+        return true;
+    }
+
+   public:
+    /// @brief Constructs a new atlas
+    /// @param budget The approximate maximum number of bytes of glyphs to keep
+    /// @param glyphs_per_font The number of glyphs to keep for each font
+    glyph_atlas(size_t budget = 16 * 1024, uint16_t glyphs_per_font = 64) : m_budget(budget), m_used(0), m_glyphs_per_font(glyphs_per_font), m_age(0) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            m_entries[i].font = nullptr;
+            m_entries[i].size = 0;
+            m_entries[i].age = 0;
+        }
+    }
+    /// @brief Destroys the atlas, freeing all glyphs
+    ~glyph_atlas() {
+        clear();
+    }
+    /// @brief Indicates the memory budget
+    /// @return The approximate maximum number of bytes of glyphs to keep
+    size_t budget() const {
+        return m_budget;
+    }
+    /// @brief Sets the memory budget, evicting fonts if necessary
+    /// @param value The approximate maximum number of bytes of glyphs to keep
+    void budget(size_t value) {
+        m_budget = value;
+        while (m_used > m_budget && evict_one())
+            ;
+    }
+    /// @brief Indicates the approximate number of bytes the cached fonts may use
+    /// @return The size in bytes
+    size_t size() const {
+        return m_used;
+    }
+    /// @brief Finds or creates the glyph caches for a font and marks them as recently used.
+    /// The caches remain valid until the next call to acquire(), so look them up each time text is drawn or measured.
+    /// @param font The font, which determines the face and the size
+    /// @param out_draw_cache Receives the draw cache
+    /// @param out_measure_cache Receives the measure cache
+    /// @return True if the caches are available, otherwise false
+    bool acquire(const gfx::font& font, gfx::font_draw_cache** out_draw_cache, gfx::font_measure_cache** out_measure_cache) {
+        entry* empty = nullptr;
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (e.font == &font) {
+                e.age = ++m_age;
+                *out_draw_cache = &e.draw;
+                *out_measure_cache = &e.measure;
+                return true;
+            }
+            if (empty == nullptr && e.font == nullptr) {
+                empty = &e;
+            }
+        }
+        // a glyph's coverage is at most a line high and about as wide
+        const size_t glyph_size = (size_t)font.line_height() * font.line_height();
+        size_t glyphs = m_glyphs_per_font;
+        if (glyph_size * glyphs > m_budget) {
+            glyphs = m_budget / (glyph_size == 0 ? 1 : glyph_size);
+        }
+        if (glyphs == 0) {
+            return false;
+        }
+        const size_t size = glyph_size * glyphs;
+        while ((empty == nullptr || m_used + size > m_budget) && evict_one()) {
+            if (empty == nullptr) {
+                for (size_t i = 0; i < max_capacity; ++i) {
+                    if (m_entries[i].font == nullptr) {
+                        empty = &m_entries[i];
+                        break;
+                    }
+                }
+            }
+        }
+        if (empty == nullptr) {
+            return false;
+        }
+        empty->draw.max_entries(glyphs);
+        // kerning pairs are stored, so measuring needs more entries than drawing
+        empty->measure.max_entries(glyphs * 2);
+        if (gfx::gfx_result::success != empty->draw.initialize() || gfx::gfx_result::success != empty->measure.initialize()) {
+            empty->draw.deinitialize();
+            empty->measure.deinitialize();
+            return false;
+        }
+        empty->font = &font;
+        empty->size = size;
+        empty->age = ++m_age;
+        m_used += size;
+        *out_draw_cache = &empty->draw;
+        *out_measure_cache = &empty->measure;
+        return true;
+    }
+    /// @brief Frees the glyphs of a font, such as before the font is destroyed
+    /// @param font The font
+    void remove(const gfx::font& font) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (m_entries[i].font == &font) {
+                free_entry(m_entries[i]);
+                return;
+            }
+        }
+    }
+    /// @brief Frees all glyphs
+    void clear() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            free_entry(m_entries[i]);
+        }
+    }
+};
+namespace helpers {
+template <bool Dummy>
+struct glyph_atlas_shared {
+    static glyph_atlas atlas;
+};
+template <bool Dummy>
+glyph_atlas glyph_atlas_shared<Dummy>::atlas;
+}  // namespace helpers
+/// @brief Retrieves the atlas screens give their text controls unless told otherwise
+/// @return The shared atlas
+inline glyph_atlas& default_glyph_atlas() {
+    return helpers::glyph_atlas_shared<true>::atlas;
+}
+}  // namespace uix
+#endif  // HTCW_UIX_GLYPH_ATLAS_HPP
@@ -1,6 +1,8 @@
 #ifndef HTCW_UIX_IMAGE_HPP
 #define HTCW_UIX_IMAGE_HPP
 #include "uix_core.hpp"
+#include "uix_image_cache.hpp"
+#include "uix_image_prefetch.hpp"
 namespace uix {
     /// @brief Represents an image
     /// @tparam ControlSurfaceType 
@@ -22,6 +24,78 @@ namespace uix {
         void* (*m_allocator)(size_t);
         void (*m_deallocator)(void*);
         uint8_t* m_render_cache;
+        image_prefetcher* m_prefetcher;
+        gfx::rgba_pixel<32> m_placeholder_color;
+        using bitmap_type = gfx::bitmap<typename ControlSurfaceType::pixel_type,typename ControlSurfaceType::palette_type>;
+        const void* cache_format() const {
+            return &helpers::image_cache_format<bitmap_type>::id[0];
+        }
+        // the decoded image from the screen's cache, if it has one
+        uint8_t* cached() const {
+            image_cache* cache = this->decoded_image_cache();
+            if(cache==nullptr || m_stream==nullptr) {
+                return nullptr;
+            }
+            return cache->find(m_stream,cache_format(),(size16)this->dimensions());
+        }
+        static void on_prefetched(void* state) {
+            ((image*)state)->invalidate();
+        }
+        // true while the prefetcher is still fetching the image. Otherwise out_data receives the staged copy, or null to read the stream directly
+        bool fetching(const uint8_t** out_data, size_t* out_size) {
+            *out_data = nullptr;
+            if(m_prefetcher==nullptr || m_stream==nullptr) {
+                return false;
+            }
+            switch(m_prefetcher->state(m_stream)) {
+                case prefetch_state::ready:
+                    *out_data = m_prefetcher->data(m_stream,out_size);
+                    return false;
+                case prefetch_state::failed:
+                    return false;
+                case prefetch_state::none:
+                    if(uix_result::success!=m_prefetcher->request(m_stream)) {
+                        return false;
+                    }
+                    // fall through
+                default:
+                    m_prefetcher->wait(m_stream,on_prefetched,this);
+                    return true;
+            }
+        }
+        // decodes the whole image for the frame, into the screen's cache if possible
+        bool decode(io::stream* stream) {
+            const size16 dim = (size16)this->dimensions();
+            const size_t size = bitmap_type::sizeof_buffer(dim);
+            image_cache* cache = this->decoded_image_cache();
+            uint8_t* buffer = nullptr;
+            if(cache!=nullptr) {
+                buffer = cache->allocate(m_stream,cache_format(),dim,size);
+            }
+            if(buffer==nullptr && m_allocator!=nullptr && m_deallocator!=nullptr) {
+                // decode for this frame only
+                m_render_cache = (uint8_t*)m_allocator(size);
+                buffer = m_render_cache;
+            }
+            if(buffer==nullptr) {
+                return false;
+            }
+            bitmap_type bmp(dim,buffer,this->palette());
+            if(m_reset_stream) {
+                stream->seek(0);         
+            }
+            if(gfx::gfx_result::success!=gfx::draw::image(bmp,bmp.bounds(),stream,bmp.bounds())) {
+                // don't keep a partial decode. paint reads the stream instead
+                if(buffer==m_render_cache) {
+                    m_deallocator(m_render_cache);
+                    m_render_cache = nullptr;
+                } else {
+                    cache->remove(m_stream,cache_format(),dim);
+                }
+                return false;
+            }
+            return true;
+        }
     protected:
         void do_move_control(image& rhs) {
             this->base_type::do_move_control(rhs);
@@ -37,6 +111,11 @@ namespace uix {
             m_deallocator = rhs.m_deallocator;
             m_render_cache = rhs.m_render_cache;
             rhs.m_render_cache = nullptr;
+            m_prefetcher = rhs.m_prefetcher;
+            if(m_prefetcher!=nullptr) {
+                m_prefetcher->cancel_wait(&rhs);
+            }
+            m_placeholder_color = rhs.m_placeholder_color;
         }
         void do_copy_control(const image& rhs) {
             this->base_type::do_copy_control(rhs);
@@ -49,6 +128,8 @@ namespace uix {
             m_allocator = rhs.m_allocator;
             m_deallocator = rhs.m_deallocator;
             m_render_cache = nullptr;
+            m_prefetcher = rhs.m_prefetcher;
+            m_placeholder_color = rhs.m_placeholder_color;
         }
     public:
         /// @brief Moves an image
@@ -78,17 +159,18 @@ namespace uix {
         /// @brief Constructs an image with the given parent and optional palette
         /// @param parent The parent - usually a screen
         /// @param palette The associated palette, usually from the screen
-        image(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(parent,palette),m_stream(nullptr), m_reset_stream(true), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator) {
+        image(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(parent,palette),m_stream(nullptr), m_reset_stream(true), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator),m_render_cache(nullptr),m_prefetcher(nullptr),m_placeholder_color(0,0,0,0) {
         }
         /// @brief Constructs an image with the given parent and optional palette
-        image(void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(),m_stream(nullptr), m_reset_stream(true), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator) {
+        image(void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(),m_stream(nullptr), m_reset_stream(true), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator),m_render_cache(nullptr),m_prefetcher(nullptr),m_placeholder_color(0,0,0,0) {
         }
         /// @brief Indicates the stream that contains the image
         /// @return A pointer to the stream
         io::stream* stream() {
             return m_stream;
         }
-        /// @brief Sets the stream that contains the image
+        /// @brief Sets the stream that contains the image. If the screen has a decoded image cache, images are cached by stream, so
+        /// remove the stream from the cache if its contents change
         /// @param stream The stream to set
         void stream(io::stream* stream, bool invalidate = true) {
             if(invalidate && m_stream!=stream) {
@@ -96,6 +178,42 @@ namespace uix {
             }
             m_stream = stream;
         }
+        /// @brief Destroys the image
+        virtual ~image() {
+            if(m_prefetcher!=nullptr) {
+                m_prefetcher->cancel_wait(this);
+            }
+        }
+        /// @brief Indicates the prefetcher the image is read through
+        /// @return The prefetcher, or null if the image is read directly from its stream
+        image_prefetcher* prefetcher() const {
+            return m_prefetcher;
+        }
+        /// @brief Sets a prefetcher to read the image through. The image is then painted from memory once the prefetcher has staged it,
+        /// and as a placeholder until then, so slow storage never holds up a frame. If it wasn't requested ahead of time it is requested when first painted.
+        /// @param value The prefetcher, or null to read the image directly from its stream
+        void prefetcher(image_prefetcher* value) {
+            if(value!=m_prefetcher) {
+                if(m_prefetcher!=nullptr) {
+                    m_prefetcher->cancel_wait(this);
+                }
+                m_prefetcher = value;
+                this->invalidate();
+            }
+        }
+        /// @brief Indicates the color painted while the image is being prefetched
+        /// @return The color
+        gfx::rgba_pixel<32> placeholder_color() const {
+            return m_placeholder_color;
+        }
+        /// @brief Sets the color painted while the image is being prefetched
+        /// @param value The color. Fully transparent paints nothing.
+        void placeholder_color(gfx::rgba_pixel<32> value) {
+            m_placeholder_color = value;
+            if(m_prefetcher!=nullptr && m_prefetcher->state(m_stream)!=prefetch_state::ready) {
+                this->invalidate();
+            }
+        }
         /// @brief Indicates whether the stream is automatically seeked to the start before the image is read from it
         /// @return True if the stream will be reset, otherwise false
         bool reset_stream() const {
@@ -108,41 +226,59 @@ namespace uix {
         }
         /// @brief Called once before the control is first rendered during update()
         virtual void on_before_paint() override {
+            if(cached()!=nullptr) {
+                // decoded on an earlier frame
+                return;
+            }
+            const uint8_t* staged;
+            size_t staged_size;
+            if(fetching(&staged,&staged_size)) {
+                // paint the placeholder
+                return;
+            }
+            if(staged!=nullptr) {
+                io::const_buffer_stream stm(staged,staged_size);
+                decode(&stm);
+                return;
+            }
             if(m_on_load_cb!=nullptr) {
                 m_on_load_cb(m_on_load_cb_state);
             }
-            
-            if(m_stream!=nullptr && m_allocator!=nullptr && m_deallocator!=nullptr) {
-                using bmp_t = gfx::bitmap<typename control_surface_type::pixel_type,typename control_surface_type::palette_type>;
-                m_render_cache = (uint8_t*)m_allocator(bmp_t::sizeof_buffer((size16)this->dimensions()));
-                if(m_render_cache!=nullptr) {
-                    bmp_t bmp((size16)this->dimensions(),m_render_cache,this->palette());
-                    if(m_reset_stream) {
-                        m_stream->seek(0);         
-                    }
-                    gfx::draw::image(bmp,bmp.bounds(),m_stream,bmp.bounds());
-                    if(m_on_unload_cb!=nullptr) {
-                        m_on_unload_cb(m_on_unload_cb_state);
-                    }
+            if(m_stream!=nullptr && decode(m_stream)) {
+                if(m_on_unload_cb!=nullptr) {
+                    m_on_unload_cb(m_on_unload_cb_state);
                 }
-            
             }
         }
         /// @brief Called once after the control is last rendered during update()
         virtual void on_after_paint() override {
             if(m_render_cache!=nullptr) {
                 m_deallocator(m_render_cache);
+                m_render_cache = nullptr;
             }
         }
         /// @brief Called when the image is painted
         /// @param destination The destination to paint to
         /// @param clip The clipping rectangle
         virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
-            if(m_render_cache!=nullptr) {
-                using bmp_t = gfx::bitmap<typename control_surface_type::pixel_type,typename control_surface_type::palette_type>;
-                bmp_t bmp((size16)this->dimensions(),m_render_cache,this->palette());
+            uint8_t* buffer = m_render_cache!=nullptr?m_render_cache:cached();
+            if(buffer!=nullptr) {
+                bitmap_type bmp((size16)this->dimensions(),buffer,this->palette());
                 gfx::draw::bitmap(destination,destination.bounds(),bmp,bmp.bounds());
             } else {
+                const uint8_t* staged;
+                size_t staged_size;
+                if(fetching(&staged,&staged_size)) {
+                    if(m_placeholder_color.opacity()!=0) {
+                        gfx::draw::filled_rectangle(destination,clip,m_placeholder_color);
+                    }
+                    return;
+                }
+                if(staged!=nullptr) {
+                    io::const_buffer_stream stm(staged,staged_size);
+                    gfx::draw::image(destination,clip,&stm,(rect16)clip);
+                    return;
+                }
                 if(m_reset_stream && m_stream!=nullptr && m_stream->caps().seek) {
                     m_stream->seek(0);
                 }
@@ -150,7 +286,8 @@ namespace uix {
                     m_on_load_cb(m_on_load_cb_state);
                 }
                 if(m_stream!=nullptr) {
-                    gfx::gfx_result res = gfx::draw::image(destination,destination.bounds(),m_stream);
+                    // hand the decoder the tile's clip so it can skip what falls outside it
+                    gfx::draw::image(destination,clip,m_stream,(rect16)clip);
                 } 
                 if(m_on_unload_cb!=nullptr) {
                     m_on_unload_cb(m_on_unload_cb_state);
@@ -1,7 +1,91 @@
 #ifndef HTCW_UIX_IMAGE_BOX_HPP
 #define HTCW_UIX_IMAGE_BOX_HPP
 #include "uix_core.hpp"
+#include "uix_image_cache.hpp"
 namespace uix {
+    namespace helpers {
+        /// @brief A draw target that decimates what is drawn to it by a power of two before passing it to another draw target.
+        /// It reports a size that many times larger than its destination and only forwards every nth row and column.
+        /// @tparam Destination The type of the draw target to forward to
+        template<typename Destination> class decimating_target final {
+        public:
+            using type = decimating_target;
+            using pixel_type = typename Destination::pixel_type;
+            using palette_type = typename Destination::palette_type;
+            using caps = gfx::gfx_caps<false, false, false, false>;
+        private:
+            Destination& m_destination;
+            uint8_t m_shift;
+        public:
+            /// @brief Constructs a new target
+            /// @param destination The draw target to forward the sampled pixels to
+            /// @param shift The decimation factor as a power of two (0 to 3)
+            decimating_target(Destination& destination, uint8_t shift) : m_destination(destination), m_shift(shift) {
+            }
+            /// @brief Retrieves the palette, if any
+            /// @return The palette
+            const palette_type* palette() const {
+                return m_destination.palette();
+            }
+            /// @brief Reports the size of the target before decimation
+            /// @return a size16 with the width and height
+            size16 dimensions() const {
+                const size16 d = m_destination.dimensions();
+                return size16(d.width << m_shift, d.height << m_shift);
+            }
+            /// @brief Reports the bounds of the target before decimation
+            /// @return a rect16 anchored to (0,0)
+            rect16 bounds() const {
+                return rect16(point16::zero(), dimensions());
+            }
+            /// @brief Reports the color of the pixel sampled for a location
+            /// @param location The location to check
+            /// @param out_pixel A pointer to the pixel data to fill
+            /// @return The result of the operation
+            gfx::gfx_result point(point16 location, pixel_type* out_pixel) const {
+                return m_destination.point(point16(location.x >> m_shift, location.y >> m_shift), out_pixel);
+            }
+            /// @brief Sets the color of a pixel, if the location is one that is sampled
+            /// @param location The location
+            /// @param pixel The new color
+            /// @return The result of the operation
+            gfx::gfx_result point(point16 location, pixel_type pixel) {
+                const uint16_t mask = (1 << m_shift) - 1;
+                if ((location.x & mask) || (location.y & mask)) {
+                    return gfx::gfx_result::success;
+                }
+                return m_destination.point(point16(location.x >> m_shift, location.y >> m_shift), pixel);
+            }
+            /// @brief Fills the sampled pixels within a rectangular region with a color
+            /// @param bounds The rect16 coordinates to fill
+            /// @param pixel The new color
+            /// @return The result of the operation
+            gfx::gfx_result fill(const rect16& bounds, pixel_type pixel) {
+                const uint16_t mask = (1 << m_shift) - 1;
+                const rect16 b = bounds.normalize();
+                const rect16 r((b.x1 + mask) >> m_shift, (b.y1 + mask) >> m_shift, b.x2 >> m_shift, b.y2 >> m_shift);
+                if (((r.x1 << m_shift) > b.x2) || ((r.y1 << m_shift) > b.y2)) {
+                    // no sampled pixel falls in the region
+                    return gfx::gfx_result::success;
+                }
+                return m_destination.fill(r, pixel);
+            }
+            /// @brief Clears the sampled pixels within a rectangular region, setting them to the default color
+            /// @param bounds The rect16 coordinates to clear
+            /// @return The result of the operation
+            gfx::gfx_result clear(const rect16& bounds) {
+                return fill(bounds, pixel_type());
+            }
+        };
+        // the largest power of two (up to 8) that an image can be reduced by while still covering an area
+        inline uint8_t decimation_shift(size16 image_dimensions, size16 area) {
+            uint8_t result = 0;
+            while (result < 3 && (image_dimensions.width >> (result + 1)) >= area.width && (image_dimensions.height >> (result + 1)) >= area.height) {
+                ++result;
+            }
+            return result;
+        }
+    }
     /// @brief Represents an image box control
     /// @tparam ControlSurfaceType 
     template<typename ControlSurfaceType> class image_box : public control<ControlSurfaceType> {
@@ -21,6 +105,22 @@ namespace uix {
         void* (*m_allocator)(size_t);
         void (*m_deallocator)(void*);
         uint8_t* m_render_cache;
+        bool m_scale_to_fit;
+        uint8_t m_shift;
+        using bitmap_type = gfx::bitmap<typename ControlSurfaceType::pixel_type,typename ControlSurfaceType::palette_type>;
+        // the reduction follows from the image, the size and scale_to_fit, so scale_to_fit is enough to
+        // keep reduced decodes apart without loading the image to learn its size
+        const void* cache_format() const {
+            return &helpers::image_cache_format<bitmap_type>::id[m_scale_to_fit?1:0];
+        }
+        // the decoded image from the screen's cache, if it has one
+        uint8_t* cached() const {
+            image_cache* cache = this->decoded_image_cache();
+            if(cache==nullptr || m_image==nullptr) {
+                return nullptr;
+            }
+            return cache->find(m_image,cache_format(),(size16)this->dimensions());
+        }
     protected:
         void do_move_control(image_box& rhs) {
             this->base_type::do_move_control(rhs);
@@ -36,6 +136,8 @@ namespace uix {
             m_deallocator = rhs.m_deallocator;
             m_render_cache = rhs.m_render_cache;
             rhs.m_render_cache = nullptr;
+            m_scale_to_fit = rhs.m_scale_to_fit;
+            m_shift = rhs.m_shift;
         }
         void do_copy_control(const image_box& rhs) {
             this->base_type::do_copy_control(rhs);
@@ -47,6 +149,8 @@ namespace uix {
             m_allocator = rhs.m_allocator;
             m_deallocator = rhs.m_deallocator;
             m_render_cache = nullptr;
+            m_scale_to_fit = rhs.m_scale_to_fit;
+            m_shift = rhs.m_shift;
         }
     public:
         /// @brief Moves an image_box
@@ -76,17 +180,18 @@ namespace uix {
         /// @brief Constructs an image_box with the given parent and optional palette
         /// @param parent The parent - usually a screen
         /// @param palette The associated palette, usually from the screen
-        image_box(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(parent,palette),m_image(nullptr), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator) {
+        image_box(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(parent,palette),m_image(nullptr), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator),m_render_cache(nullptr),m_scale_to_fit(false),m_shift(0) {
         }
         /// @brief Constructs an image_box with the given parent and optional palette
-        image_box(void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(),m_image(nullptr), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator) {
+        image_box(void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(),m_image(nullptr), m_on_load_cb(nullptr),m_on_load_cb_state(nullptr),m_allocator(allocator),m_deallocator(deallocator),m_render_cache(nullptr),m_scale_to_fit(false),m_shift(0) {
         }
         /// @brief Indicates the image to display
         /// @return A pointer to the image
         gfx::image* image() const {
             return m_image;
         }
-        /// @brief Sets the image to displate
+        /// @brief Sets the image to display. If the screen has a decoded image cache, images are cached by image object, so
+        /// remove the image from the cache if its contents change
         /// @param image The image to set
         void image(gfx::image& image, bool invalidate = true) {
             if(invalidate && &image!=m_image) {
@@ -94,19 +199,53 @@ namespace uix {
             }
             m_image = &image;
         }
+        /// @brief Indicates whether images larger than the control are reduced while they are decoded
+        /// @return True if images are scaled to fit, otherwise false
+        bool scale_to_fit() const {
+            return m_scale_to_fit;
+        }
+        /// @brief Sets whether images larger than the control are reduced while they are decoded. The image is reduced by the largest of 1/2, 1/4 or 1/8
+        /// that still covers the control, by skipping rows and columns, so only the pixels that are displayed are written.
+        /// @param value True to scale images to fit, otherwise false
+        void scale_to_fit(bool value) {
+            if(value!=m_scale_to_fit) {
+                // the other decode is keyed apart and may be shared, so it is left to age out
+                m_scale_to_fit = value;
+                this->invalidate();
+            }
+        }
         /// @brief Called once before the control is first rendered during update()
         virtual void on_before_paint() override {
+            if(cached()!=nullptr) {
+                // decoded on an earlier frame
+                return;
+            }
             if(m_on_load_cb!=nullptr) {
                 m_on_load_cb(m_on_load_cb_state);
             }
+            m_shift = 0;
             if(m_image!=nullptr) {
                 m_image->initialize();
-                if(m_allocator!=nullptr && m_deallocator!=nullptr) {
-                    using bmp_t = gfx::bitmap<typename control_surface_type::pixel_type,typename control_surface_type::palette_type>;
-                    m_render_cache = nullptr;//(uint8_t*)m_allocator(bmp_t::sizeof_buffer((size16)this->dimensions()));
-                    if(m_render_cache!=nullptr) {
-                        bmp_t bmp((size16)this->dimensions(),m_render_cache,this->palette());
-                        gfx::draw::image(bmp,bmp.bounds(),*m_image,bmp.bounds());
+                if(m_scale_to_fit) {
+                    m_shift = helpers::decimation_shift(m_image->dimensions(),(size16)this->dimensions());
+                }
+                image_cache* cache = this->decoded_image_cache();
+                if(cache!=nullptr) {
+                    const size16 dim = (size16)this->dimensions();
+                    uint8_t* buffer = cache->allocate(m_image,cache_format(),dim,bitmap_type::sizeof_buffer(dim));
+                    if(buffer!=nullptr) {
+                        bitmap_type bmp(dim,buffer,this->palette());
+                        gfx::gfx_result r;
+                        if(m_shift!=0) {
+                            helpers::decimating_target<bitmap_type> dt(bmp,m_shift);
+                            r = gfx::draw::image(dt,dt.bounds(),*m_image,dt.bounds());
+                        } else {
+                            r = gfx::draw::image(bmp,bmp.bounds(),*m_image,bmp.bounds());
+                        }
+                        if(r!=gfx::gfx_result::success) {
+                            // don't keep a partial decode. paint decodes each tile instead
+                            cache->remove(m_image,cache_format(),dim);
+                        }
                         if(m_on_unload_cb!=nullptr) {
                             m_on_unload_cb(m_on_unload_cb_state);
                         }
@@ -118,27 +257,35 @@ namespace uix {
         virtual void on_after_paint() override {
             if(m_render_cache!=nullptr) {
                 m_deallocator(m_render_cache);
+                m_render_cache = nullptr;
             }
         }
         /// @brief Called when the image_box is painted
         /// @param destination The destination to paint to
         /// @param clip The clipping rectangle
         virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
-            // if(m_render_cache!=nullptr) {
-            //     using bmp_t = gfx::bitmap<typename control_surface_type::pixel_type,typename control_surface_type::palette_type>;
-            //     bmp_t bmp((size16)this->dimensions(),m_render_cache,this->palette());
-            //     gfx::draw::bitmap(destination,destination.bounds(),bmp,bmp.bounds());
-            // } else {
+            uint8_t* buffer = cached();
+            if(buffer!=nullptr) {
+                bitmap_type bmp((size16)this->dimensions(),buffer,this->palette());
+                gfx::draw::bitmap(destination,destination.bounds(),bmp,bmp.bounds());
+            } else {
                 if(m_on_load_cb!=nullptr) {
                     m_on_load_cb(m_on_load_cb_state);
                 }
                 if(m_image!=nullptr) {
-                    gfx::draw::image(destination,destination.bounds(),*m_image);
+                    // hand the decoder the tile's clip so it can skip what falls outside it
+                    if(m_shift!=0) {
+                        helpers::decimating_target<control_surface_type> dt(destination,m_shift);
+                        const srect16 sclip(clip.x1<<m_shift,clip.y1<<m_shift,((clip.x2+1)<<m_shift)-1,((clip.y2+1)<<m_shift)-1);
+                        gfx::draw::image(dt,sclip,*m_image,(rect16)sclip);
+                    } else {
+                        gfx::draw::image(destination,clip,*m_image,(rect16)clip);
+                    }
                 } 
                 if(m_on_unload_cb!=nullptr) {
                     m_on_unload_cb(m_on_unload_cb_state);
                 }
-            //}
+            }
             
         }
         /// @brief Returns the on_load_callback handler
@@ -0,0 +1,167 @@
+#ifndef HTCW_UIX_IMAGE_CACHE_HPP
+#define HTCW_UIX_IMAGE_CACHE_HPP
+#include <htcw_data.hpp>
+#include "uix_core.hpp"
+namespace uix {
+/// @brief A cache of decoded images which persists across frames. Images are keyed by their source, the pixel format they were decoded to, and their size.
+/// When the memory budget is exceeded the least recently used images are evicted.
+class image_cache final {
+    struct entry {
+        const void* source;
+        const void* format;
+        size16 dimensions;
+        size_t size;
+        uint32_t age;
+        uint8_t* buffer;
+    };
+    using entries_type = data::simple_vector<entry>;
+    entries_type m_entries;
+    size_t m_budget;
+    size_t m_used;
+    uint32_t m_age;
+    void* (*m_allocator)(size_t);
+    void (*m_deallocator)(void*);
+    image_cache(const image_cache& rhs) = delete;
+    image_cache& operator=(const image_cache& rhs) = delete;
+    image_cache(image_cache&& rhs) = delete;
+    image_cache& operator=(image_cache&& rhs) = delete;
+    void free_entry(entry* it) {
+        m_deallocator(it->buffer);
+        m_used -= it->size;
+        m_entries.erase(it, it);
+    }
+    bool evict_one() {
+        entry* victim = nullptr;
+        for (entry* it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (victim == nullptr || it->age < victim->age) {
+                victim = it;
+            }
+        }
+        if (victim == nullptr) {
+            return false;
+        }
+        free_entry(victim);
+        return true;
+    }
+
+   public:
+    /// @brief Constructs a new cache
+    /// @param budget The maximum number of bytes of decoded image data to keep
+    /// @param allocator The allocator for the decoded images (such as one that places them in PSRAM)
+    /// @param reallocator The reallocator for the cache bookkeeping
+    /// @param deallocator The deallocator for the decoded images
+    image_cache(size_t budget, void*(allocator)(size_t) = ::malloc, void*(reallocator)(void*, size_t) = ::realloc, void(deallocator)(void*) = ::free) : m_entries(allocator, reallocator, deallocator), m_budget(budget), m_used(0), m_age(0), m_allocator(allocator), m_deallocator(deallocator) {
+    }
+    /// @brief Destroys the cache, freeing all images
+    ~image_cache() {
+        clear();
+    }
+    /// @brief Indicates the memory budget
+    /// @return The maximum number of bytes of decoded image data to keep
+    size_t budget() const {
+        return m_budget;
+    }
+    /// @brief Sets the memory budget, evicting images if necessary
+    /// @param value The maximum number of bytes of decoded image data to keep
+    void budget(size_t value) {
+        m_budget = value;
+        while (m_used > m_budget && evict_one())
+            ;
+    }
+    /// @brief Indicates the number of bytes of decoded image data currently held
+    /// @return The size in bytes
+    size_t size() const {
+        return m_used;
+    }
+    /// @brief Indicates the number of images currently held
+    /// @return The count of images
+    size_t count() const {
+        return m_entries.size();
+    }
+    /// @brief Finds a decoded image and marks it as recently used
+    /// @param source The identity of the image source, such as its stream or image object
+    /// @param format The identity of the pixel format it was decoded to
+    /// @param dimensions The size it was decoded to
+    /// @return The decoded image data, or null if it isn't cached
+    uint8_t* find(const void* source, const void* format, size16 dimensions) {
+        for (entry* it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->source == source && it->format == format && it->dimensions.width == dimensions.width && it->dimensions.height == dimensions.height) {
+                it->age = ++m_age;
+                return it->buffer;
+            }
+        }
+        return nullptr;
+    }
+    /// @brief Allocates space for a decoded image, evicting the least recently used images to stay within budget.
+    /// The caller decodes into the returned buffer.
+    /// @param source The identity of the image source, such as its stream or image object
+    /// @param format The identity of the pixel format it will be decoded to
+    /// @param dimensions The size it will be decoded to
+    /// @param size The size of the decoded image data in bytes
+    /// @return The buffer to decode into, or null if it doesn't fit in the budget or memory
+    uint8_t* allocate(const void* source, const void* format, size16 dimensions, size_t size) {
+        if (size > m_budget) {
+            return nullptr;
+        }
+        remove(source, format, dimensions);
+        while (m_used + size > m_budget && evict_one())
+            ;
+        uint8_t* buffer = (uint8_t*)m_allocator(size);
+        while (buffer == nullptr && evict_one()) {
+            buffer = (uint8_t*)m_allocator(size);
+        }
+        if (buffer == nullptr) {
+            return nullptr;
+        }
+        if (!m_entries.push_back({source, format, dimensions, size, ++m_age, buffer})) {
+            m_deallocator(buffer);
+            return nullptr;
+        }
+        m_used += size;
+        return buffer;
+    }
+    /// @brief Removes a decoded image
+    /// @param source The identity of the image source
+    /// @param format The identity of the pixel format it was decoded to
+    /// @param dimensions The size it was decoded to
+    void remove(const void* source, const void* format, size16 dimensions) {
+        for (entry* it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->source == source && it->format == format && it->dimensions.width == dimensions.width && it->dimensions.height == dimensions.height) {
+                free_entry(it);
+                return;
+            }
+        }
+    }
+    /// @brief Removes every decoded image of a source, such as when its contents change
+    /// @param source The identity of the image source
+    void remove(const void* source) {
+        entry* it = m_entries.begin();
+        while (it != m_entries.end()) {
+            if (it->source == source) {
+                free_entry(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    /// @brief Frees all decoded images
+    void clear() {
+        for (entry* it = m_entries.begin(); it != m_entries.end(); ++it) {
+            m_deallocator(it->buffer);
+        }
+        m_entries.clear();
+        m_used = 0;
+    }
+};
+namespace helpers {
+// a unique address per type, to tell pixel formats apart in the image cache.
+// id[0] is the plain decode, id[1] the decode reduced to fit its control
+template <typename T>
+struct image_cache_format {
+    static const char id[2];
+};
+template <typename T>
+const char image_cache_format<T>::id[2] = {0, 0};
+}  // namespace helpers
+}  // namespace uix
+#endif  // HTCW_UIX_IMAGE_CACHE_HPP
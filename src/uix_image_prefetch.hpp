@@ -0,0 +1,270 @@
+#ifndef HTCW_UIX_IMAGE_PREFETCH_HPP
+#define HTCW_UIX_IMAGE_PREFETCH_HPP
+#include <atomic>
+#include "uix_core.hpp"
+namespace uix {
+/// @brief The state of an image being prefetched
+enum struct prefetch_state : uint8_t {
+    /// @brief The image has not been requested
+    none = 0,
+    /// @brief The image is waiting to be read
+    queued,
+    /// @brief The image is being read
+    loading,
+    /// @brief The image is staged in memory
+    ready,
+    /// @brief The image could not be read
+    failed
+};
+/// @brief Reads images from slow storage into memory ahead of time, so controls can decode them without waiting on the storage.
+/// The reading is done incrementally by pump(), which can be called from the application loop or from a background task.
+/// Only pump() may run on another task, and only one task may pump: request, release and dispatch from the same task that updates the screen.
+class image_prefetcher final {
+   public:
+    /// @brief The maximum number of images a prefetcher can track
+    constexpr static const size_t max_capacity = 8;
+    /// @brief The maximum number of callbacks that can wait on one image
+    constexpr static const size_t max_waiters = 4;
+    /// @brief The callback type for being notified an image is ready
+    typedef void (*callback_type)(void* state);
+
+   private:
+    struct waiter {
+        callback_type callback;
+        void* state;
+    };
+    struct slot {
+        io::stream* source;
+        uint8_t* data;
+        size_t size;
+        size_t capacity;
+        // written by the updating task while none, queued, ready or failed, and by pump() while loading
+        std::atomic<prefetch_state> state;
+        waiter waiters[max_waiters];
+    };
+    slot m_slots[max_capacity];
+    void* (*m_reallocator)(void*, size_t);
+    void (*m_deallocator)(void*);
+    image_prefetcher(const image_prefetcher& rhs) = delete;
+    image_prefetcher& operator=(const image_prefetcher& rhs) = delete;
+    image_prefetcher(image_prefetcher&& rhs) = delete;
+    image_prefetcher& operator=(image_prefetcher&& rhs) = delete;
+    slot* find(const io::stream* source) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (m_slots[i].state.load(std::memory_order_acquire) != prefetch_state::none && m_slots[i].source == source) {
+                return &m_slots[i];
+            }
+        }
+        return nullptr;
+    }
+    const slot* find(const io::stream* source) const {
+        return const_cast<image_prefetcher*>(this)->find(source);
+    }
+    // the slot must not be loading
+    void free_slot(slot& s) {
+        if (s.data != nullptr) {
+            m_deallocator(s.data);
+        }
+        s.data = nullptr;
+        s.size = 0;
+        s.capacity = 0;
+        s.source = nullptr;
+        for (size_t i = 0; i < max_waiters; ++i) {
+            s.waiters[i].callback = nullptr;
+        }
+        s.state.store(prefetch_state::none, std::memory_order_release);
+    }
+    // frees the slot unless pump() has it. A queued slot is taken back first so pump() can't claim it while it is freed
+    void release_slot(slot& s) {
+        prefetch_state st = prefetch_state::queued;
+        if (!s.state.compare_exchange_strong(st, prefetch_state::none, std::memory_order_acq_rel, std::memory_order_acquire) &&
+            st == prefetch_state::loading) {
+            return;
+        }
+        free_slot(s);
+    }
+
+   public:
+    /// @brief Constructs a new prefetcher
+    /// @param reallocator The reallocator for the staged images (such as one that places them in PSRAM)
+    /// @param deallocator The deallocator for the staged images
+    image_prefetcher(void*(reallocator)(void*, size_t) = ::realloc, void(deallocator)(void*) = ::free) : m_reallocator(reallocator), m_deallocator(deallocator) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            m_slots[i].data = nullptr;
+            free_slot(m_slots[i]);
+        }
+    }
+    /// @brief Destroys the prefetcher, freeing all staged images. pump() must not be running.
+    ~image_prefetcher() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            free_slot(m_slots[i]);
+        }
+    }
+    /// @brief Requests an image be read into memory. The stream must stay open until the image is ready.
+    /// @param source The stream holding the image. It will be read from the start.
+    /// @return The result of the operation
+    uix_result request(io::stream* source) {
+        if (source == nullptr) {
+            return uix_result::invalid_argument;
+        }
+        if (find(source) != nullptr) {
+            return uix_result::success;
+        }
+        for (size_t i = 0; i < max_capacity; ++i) {
+            slot& s = m_slots[i];
+            if (s.state.load(std::memory_order_acquire) == prefetch_state::none) {
+                s.source = source;
+                // publish last, so pump() sees a complete slot
+                s.state.store(prefetch_state::queued, std::memory_order_release);
+                return uix_result::success;
+            }
+        }
+        return uix_result::out_of_memory;
+    }
+    /// @brief Indicates how far along an image is
+    /// @param source The stream holding the image
+    /// @return The state of the image
+    prefetch_state state(const io::stream* source) const {
+        const slot* s = find(source);
+        return s == nullptr ? prefetch_state::none : s->state.load(std::memory_order_acquire);
+    }
+    /// @brief Retrieves a staged image
+    /// @param source The stream holding the image
+    /// @param out_size Receives the size of the image data in bytes
+    /// @return The image data, or null if it isn't ready
+    const uint8_t* data(const io::stream* source, size_t* out_size) const {
+        const slot* s = find(source);
+        if (s == nullptr || s->state.load(std::memory_order_acquire) != prefetch_state::ready) {
+            return nullptr;
+        }
+        if (out_size != nullptr) {
+            *out_size = s->size;
+        }
+        return s->data;
+    }
+    /// @brief Registers a callback to be called from dispatch() once an image is ready or has failed
+    /// @param source The stream holding the image, which must have been requested
+    /// @param callback The callback
+    /// @param state A user defined state passed to the callback
+    /// @return The result of the operation
+    uix_result wait(const io::stream* source, callback_type callback, void* state = nullptr) {
+        slot* s = find(source);
+        if (s == nullptr || callback == nullptr) {
+            return uix_result::invalid_argument;
+        }
+        waiter* empty = nullptr;
+        for (size_t i = 0; i < max_waiters; ++i) {
+            waiter& w = s->waiters[i];
+            if (w.callback == callback && w.state == state) {
+                return uix_result::success;
+            }
+            if (empty == nullptr && w.callback == nullptr) {
+                empty = &w;
+            }
+        }
+        if (empty == nullptr) {
+            return uix_result::out_of_memory;
+        }
+        empty->state = state;
+        empty->callback = callback;
+        return uix_result::success;
+    }
+    /// @brief Removes a callback registered with wait() from every image
+    /// @param state The user defined state the callback was registered with
+    void cancel_wait(void* state) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            for (size_t j = 0; j < max_waiters; ++j) {
+                waiter& w = m_slots[i].waiters[j];
+                if (w.callback != nullptr && w.state == state) {
+                    w.callback = nullptr;
+                }
+            }
+        }
+    }
+    /// @brief Reads part of the next image waiting to be read
+    /// @param max_bytes The most bytes to read during this call, so callers on the render loop can bound the time spent
+    /// @return True if there is more to read, otherwise false
+    bool pump(size_t max_bytes = 4096) {
+        slot* s = nullptr;
+        for (size_t i = 0; i < max_capacity && s == nullptr; ++i) {
+            if (m_slots[i].state.load(std::memory_order_acquire) == prefetch_state::loading) {
+                s = &m_slots[i];
+            }
+        }
+        // claim a queued slot. release() may free one between seeing it and claiming it, so only a won exchange counts
+        for (size_t i = 0; i < max_capacity && s == nullptr; ++i) {
+            prefetch_state st = prefetch_state::queued;
+            if (m_slots[i].state.compare_exchange_strong(st, prefetch_state::loading, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                s = &m_slots[i];
+                if (s->source->caps().seek) {
+                    s->source->seek(0);
+                }
+            }
+        }
+        if (s == nullptr) {
+            return false;
+        }
+        while (max_bytes > 0) {
+            if (s->size == s->capacity) {
+                const size_t capacity = s->capacity == 0 ? 1024 : s->capacity * 2;
+                uint8_t* data = (uint8_t*)m_reallocator(s->data, capacity);
+                if (data == nullptr) {
+                    m_deallocator(s->data);
+                    s->data = nullptr;
+                    s->size = 0;
+                    s->capacity = 0;
+                    s->state.store(prefetch_state::failed, std::memory_order_release);
+                    return true;
+                }
+                s->data = data;
+                s->capacity = capacity;
+            }
+            size_t chunk = s->capacity - s->size;
+            if (chunk > max_bytes) {
+                chunk = max_bytes;
+            }
+            const size_t read = s->source->read(s->data + s->size, chunk);
+            if (read == 0) {
+                // publish last, so the updating task sees the whole image
+                s->state.store(s->size == 0 ? prefetch_state::failed : prefetch_state::ready, std::memory_order_release);
+                return true;
+            }
+            s->size += read;
+            max_bytes -= read;
+        }
+        return true;
+    }
+    /// @brief Calls the callbacks waiting on images that have finished. Call this from the task that updates the screen.
+    void dispatch() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            slot& s = m_slots[i];
+            const prefetch_state st = s.state.load(std::memory_order_acquire);
+            if (st == prefetch_state::ready || st == prefetch_state::failed) {
+                for (size_t j = 0; j < max_waiters; ++j) {
+                    waiter& w = s.waiters[j];
+                    if (w.callback != nullptr) {
+                        callback_type cb = w.callback;
+                        w.callback = nullptr;
+                        cb(w.state);
+                    }
+                }
+            }
+        }
+    }
+    /// @brief Frees a staged or queued image. An image that is loading is left for pump() to finish.
+    /// @param source The stream holding the image
+    void release(const io::stream* source) {
+        slot* s = find(source);
+        if (s != nullptr) {
+            release_slot(*s);
+        }
+    }
+    /// @brief Frees every image that is not loading
+    void clear() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            release_slot(m_slots[i]);
+        }
+    }
+};
+}  // namespace uix
+#endif  // HTCW_UIX_IMAGE_PREFETCH_HPP
@@ -0,0 +1,562 @@
+#ifndef HTCW_UIX_KEYPAD_HPP
+#define HTCW_UIX_KEYPAD_HPP
+#include <math.h>
+#include "uix_canvas_control.hpp"
+#include "uix_mask.hpp"
+#include "uix_shape.hpp"
+namespace uix {
+/// @brief A grid of keys, such as a numeric keypad or an on screen keyboard, drawn from faces and labels rendered once
+/// @tparam ControlSurfaceType The control surface type, usually from the screen
+template <typename ControlSurfaceType>
+class keypad : public control<ControlSurfaceType> {
+   public:
+    using type = keypad;
+    using base_type = control<ControlSurfaceType>;
+    using pixel_type = typename ControlSurfaceType::pixel_type;
+    using palette_type = typename ControlSurfaceType::palette_type;
+    using control_surface_type = ControlSurfaceType;
+    typedef void (*on_key_pressed_changed_callback_type)(size_t index, bool pressed, void* state);
+    /// @brief The most keys a keypad holds
+    constexpr static const size_t max_keys = 48;
+
+   private:
+    struct key_entry {
+        const char* text;
+        // where the label sits in the label atlas, and where its text is drawn to put it there
+        uint16_t label_x;
+        size16 label_size;
+        gfx::pointf label_origin;
+    };
+    key_entry m_keys[max_keys];
+    size_t m_keys_size;
+    uint8_t m_columns;
+    gfx::canvas_text_info m_text_info;
+    gfx::rgba_pixel<32> m_color;
+    gfx::rgba_pixel<32> m_background_color;
+    gfx::rgba_pixel<32> m_border_color;
+    gfx::rgba_pixel<32> m_pressed_color;
+    gfx::rgba_pixel<32> m_pressed_background_color;
+    uint16_t m_border_width;
+    size16 m_radiuses;
+    uint16_t m_margin;
+    int m_pressed;
+    on_key_pressed_changed_callback_type m_on_key_pressed_changed_callback;
+    void* m_on_key_pressed_changed_callback_state;
+    // every key shares one frame, and every label lives in one strip, painted in the colors of the key's state
+    rounded_shape m_face_fill, m_face_border;
+    coverage_mask m_labels;
+    bool m_faces_dirty;
+    bool m_labels_dirty;
+    bool has_font() const {
+        return m_text_info.ttf_font != nullptr && m_text_info.font_size != 0 && m_text_info.encoding != nullptr;
+    }
+    uint8_t rows() const {
+        return m_columns == 0 ? 0 : (uint8_t)((m_keys_size + m_columns - 1) / m_columns);
+    }
+    ssize16 cell_size() const {
+        const uint8_t r = rows();
+        if (r == 0) {
+            return {0, 0};
+        }
+        const ssize16 dim = this->dimensions();
+        return ssize16(dim.width / m_columns, dim.height / r);
+    }
+    ssize16 key_size() const {
+        const ssize16 cell = cell_size();
+        return ssize16(cell.width - m_margin * 2, cell.height - m_margin * 2);
+    }
+    void build_faces() {
+        m_faces_dirty = false;
+        m_face_fill.clear();
+        m_face_border.clear();
+        const ssize16 ksz = key_size();
+        if (ksz.width <= 0 || ksz.height <= 0) {
+            return;
+        }
+        gfx::rectf rf = (gfx::rectf)srect16(spoint16::zero(), ksz);
+        // keep the anti-aliased edge within the key
+        rf.inflate_inplace(-1, -1);
+        const float stroke = m_border_width * 0.5f;
+        if (uix_result::success != m_face_fill.fill(rf, (gfx::sizef)m_radiuses) ||
+            (stroke > 0.f && uix_result::success != m_face_border.stroke(rf, (gfx::sizef)m_radiuses, stroke))) {
+            m_face_fill.clear();
+            m_face_border.clear();
+        }
+    }
+    static void render_labels(gfx::canvas& dst, void* state) {
+        keypad* t = (keypad*)state;
+        coverage_mask::ink_style(dst, true);
+        gfx::canvas_text_info cti = t->m_text_info;
+        for (size_t i = 0; i < t->m_keys_size; ++i) {
+            const key_entry& k = t->m_keys[i];
+            if (k.text == nullptr || k.label_size.width == 0) {
+                continue;
+            }
+            cti.text_sz(k.text);
+            dst.text(k.label_origin, cti);
+            dst.render();
+        }
+    }
+    void build_labels() {
+        m_labels_dirty = false;
+        m_labels.clear();
+        for (size_t i = 0; i < m_keys_size; ++i) {
+            m_keys[i].label_size = {0, 0};
+        }
+        if (!has_font()) {
+            return;
+        }
+        // measure every label and lay them out side by side in one strip
+        gfx::canvas_path p;
+        if (gfx::gfx_result::success != p.initialize()) {
+            return;
+        }
+        gfx::canvas_text_info cti = m_text_info;
+        uint16_t width = 0, height = 0;
+        for (size_t i = 0; i < m_keys_size; ++i) {
+            key_entry& k = m_keys[i];
+            if (k.text == nullptr || *k.text == '\0') {
+                continue;
+            }
+            p.clear();
+            cti.text_sz(k.text);
+            p.text({0.f, 0.f}, cti);
+            const gfx::rectf b = p.bounds(true);
+            const uint16_t w = (uint16_t)ceilf(b.width()) + 1;
+            const uint16_t h = (uint16_t)ceilf(b.height()) + 1;
+            k.label_x = width;
+            k.label_size = size16(w, h);
+            k.label_origin = gfx::pointf(width - b.x1, -b.y1);
+            width += w;
+            if (h > height) {
+                height = h;
+            }
+        }
+        p.deinitialize();
+        if (width == 0 || uix_result::success != m_labels.render(size16(width, height), render_labels, this)) {
+            m_labels.clear();
+        }
+    }
+    void press(int index) {
+        if (index == m_pressed) {
+            return;
+        }
+        const int old = m_pressed;
+        m_pressed = index;
+        if (old != -1) {
+            this->invalidate(key_bounds(old));
+            on_key_pressed_changed(old, false);
+        }
+        if (index != -1) {
+            this->invalidate(key_bounds(index));
+            on_key_pressed_changed(index, true);
+        }
+    }
+    void paint_key(control_surface_type& destination, size_t index, const srect16& clip) {
+        const key_entry& k = m_keys[index];
+        const srect16 kb = key_bounds(index);
+        if (k.text == nullptr || !clip.intersects(kb)) {
+            return;
+        }
+        const srect16 kc = clip.crop(kb);
+        const bool pressed = (int)index == m_pressed;
+        if (m_face_fill.valid()) {
+            m_face_fill.paint(destination, kb.point1(), pressed ? m_pressed_background_color : m_background_color, kc);
+            if (m_face_border.valid()) {
+                m_face_border.paint(destination, kb.point1(), m_border_color, kc);
+            }
+        }
+        if (m_labels.valid() && k.label_size.width != 0) {
+            const spoint16 lpt(kb.x1 + (kb.width() - k.label_size.width) / 2, kb.y1 + (kb.height() - k.label_size.height) / 2);
+            const srect16 lr(lpt, (ssize16)k.label_size);
+            if (kc.intersects(lr)) {
+                // paint the strip so this key's label lands on the key, and clip away its neighbors
+                const srect16 lc = kc.crop(lr);
+                m_labels.paint(destination, spoint16(lpt.x - k.label_x, lpt.y), pressed ? m_pressed_color : m_color, &lc);
+            }
+        }
+    }
+
+   protected:
+    void do_move_control(keypad& rhs) {
+        this->base_type::do_move_control(rhs);
+        for (size_t i = 0; i < rhs.m_keys_size; ++i) {
+            m_keys[i] = rhs.m_keys[i];
+        }
+        m_keys_size = rhs.m_keys_size;
+        m_columns = rhs.m_columns;
+        m_text_info = rhs.m_text_info;
+        m_color = rhs.m_color;
+        m_background_color = rhs.m_background_color;
+        m_border_color = rhs.m_border_color;
+        m_pressed_color = rhs.m_pressed_color;
+        m_pressed_background_color = rhs.m_pressed_background_color;
+        m_border_width = rhs.m_border_width;
+        m_radiuses = rhs.m_radiuses;
+        m_margin = rhs.m_margin;
+        m_pressed = rhs.m_pressed;
+        rhs.m_pressed = -1;
+        m_on_key_pressed_changed_callback = rhs.m_on_key_pressed_changed_callback;
+        rhs.m_on_key_pressed_changed_callback = nullptr;
+        m_on_key_pressed_changed_callback_state = rhs.m_on_key_pressed_changed_callback_state;
+        m_face_fill = helpers::uix_move(rhs.m_face_fill);
+        m_face_border = helpers::uix_move(rhs.m_face_border);
+        m_labels = helpers::uix_move(rhs.m_labels);
+        m_faces_dirty = rhs.m_faces_dirty;
+        m_labels_dirty = rhs.m_labels_dirty;
+    }
+    void do_copy_control(const keypad& rhs) {
+        this->base_type::do_copy_control(rhs);
+        for (size_t i = 0; i < rhs.m_keys_size; ++i) {
+            m_keys[i] = rhs.m_keys[i];
+        }
+        m_keys_size = rhs.m_keys_size;
+        m_columns = rhs.m_columns;
+        m_text_info = rhs.m_text_info;
+        m_color = rhs.m_color;
+        m_background_color = rhs.m_background_color;
+        m_border_color = rhs.m_border_color;
+        m_pressed_color = rhs.m_pressed_color;
+        m_pressed_background_color = rhs.m_pressed_background_color;
+        m_border_width = rhs.m_border_width;
+        m_radiuses = rhs.m_radiuses;
+        m_margin = rhs.m_margin;
+        m_pressed = -1;
+        m_on_key_pressed_changed_callback = rhs.m_on_key_pressed_changed_callback;
+        m_on_key_pressed_changed_callback_state = rhs.m_on_key_pressed_changed_callback_state;
+        m_faces_dirty = true;
+        m_labels_dirty = true;
+    }
+    /// @brief Called when a key is pressed or released
+    /// @param index The index of the key
+    /// @param pressed True if the key was pressed, or false if it was released
+    virtual void on_key_pressed_changed(size_t index, bool pressed) {
+        if (m_on_key_pressed_changed_callback != nullptr) {
+            m_on_key_pressed_changed_callback(index, pressed, m_on_key_pressed_changed_callback_state);
+        }
+    }
+    /// @brief Called before the control is rendered
+    virtual void on_before_paint() override {
+        if (m_faces_dirty) {
+            build_faces();
+        }
+        if (m_labels_dirty) {
+            build_labels();
+        }
+    }
+    /// @brief Called when the control is resized
+    virtual void on_after_resize() override {
+        m_faces_dirty = true;
+    }
+    /// @brief Called to paint the control
+    /// @param destination The destination to draw to
+    /// @param clip The clipping rectangle
+    virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
+        const ssize16 cell = cell_size();
+        if (cell.width <= 0 || cell.height <= 0) {
+            return;
+        }
+        // only visit the keys under the clip
+        const int c2 = clip.x2 / cell.width < m_columns - 1 ? clip.x2 / cell.width : m_columns - 1;
+        const int r2 = clip.y2 / cell.height < rows() - 1 ? clip.y2 / cell.height : rows() - 1;
+        for (int r = clip.y1 / cell.height; r <= r2; ++r) {
+            for (int c = clip.x1 / cell.width; c <= c2; ++c) {
+                const size_t i = (size_t)r * m_columns + c;
+                if (i >= m_keys_size) {
+                    return;
+                }
+                paint_key(destination, i, clip);
+            }
+        }
+    }
+    /// @brief Called when the keypad is touched
+    /// @param locations_size The count of locations
+    /// @param locations The locations
+    /// @return True if a key was touched, otherwise false
+    virtual bool on_touch(size_t locations_size, const spoint16* locations) override {
+        // sliding off a key releases it, and sliding onto another presses that one
+        const int index = key_at(locations[0]);
+        press(index);
+        return index != -1;
+    }
+    /// @brief Called when the keypad is released
+    virtual void on_release() override {
+        press(-1);
+    }
+
+   public:
+    /// @brief Moves a keypad
+    /// @param rhs The keypad to move
+    keypad(keypad&& rhs) {
+        do_move_control(rhs);
+    }
+    /// @brief Moves a keypad
+    /// @param rhs The keypad to move
+    /// @return this
+    keypad& operator=(keypad&& rhs) {
+        do_move_control(rhs);
+        return *this;
+    }
+    /// @brief Copies a keypad
+    /// @param rhs The keypad to copy
+    keypad(const keypad& rhs) {
+        do_copy_control(rhs);
+    }
+    /// @brief Copies a keypad
+    /// @param rhs The keypad to copy
+    /// @return this
+    keypad& operator=(const keypad& rhs) {
+        do_copy_control(rhs);
+        return *this;
+    }
+    /// @brief Constructs an empty keypad
+    keypad() : base_type(), m_keys_size(0), m_columns(0), m_border_width(2), m_radiuses(4, 4), m_margin(2), m_pressed(-1), m_on_key_pressed_changed_callback(nullptr), m_on_key_pressed_changed_callback_state(nullptr), m_faces_dirty(true), m_labels_dirty(true) {
+        constexpr static const auto white = gfx::rgba_pixel<32>(0xFF, 0xFF, 0xFF, 0xFF);
+        constexpr static const auto gray = gfx::rgba_pixel<32>(0x7F, 0x7F, 0x7F, 0xFF);
+        m_color = white;
+        m_background_color = gray;
+        m_border_color = white;
+        m_pressed_color = gray;
+        m_pressed_background_color = white;
+        m_text_info.ttf_font = nullptr;
+        m_text_info.font_size = 0;
+        m_text_info.encoding = &gfx::text_encoding::utf8;
+    }
+    /// @brief Constructs a keypad given a parent and an optional palette
+    /// @param parent The parent invalidation tracker - usually a screen
+    /// @param palette The palette. Typically the screen's palette()
+    keypad(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_keys_size(0), m_columns(0), m_border_width(2), m_radiuses(4, 4), m_margin(2), m_pressed(-1), m_on_key_pressed_changed_callback(nullptr), m_on_key_pressed_changed_callback_state(nullptr), m_faces_dirty(true), m_labels_dirty(true) {
+        constexpr static const auto white = gfx::rgba_pixel<32>(0xFF, 0xFF, 0xFF, 0xFF);
+        constexpr static const auto gray = gfx::rgba_pixel<32>(0x7F, 0x7F, 0x7F, 0xFF);
+        m_color = white;
+        m_background_color = gray;
+        m_border_color = white;
+        m_pressed_color = gray;
+        m_pressed_background_color = white;
+        m_text_info.ttf_font = nullptr;
+        m_text_info.font_size = 0;
+        m_text_info.encoding = &gfx::text_encoding::utf8;
+    }
+    /// @brief Sets the keys, laid out left to right and top to bottom in a grid of equally sized cells
+    /// @param value The key labels. A null entry leaves its cell empty. The strings must remain valid while the keypad uses them.
+    /// @param size The number of keys, including empty cells
+    /// @param columns The number of keys in each row
+    /// @return The result of the operation
+    uix_result keys(const char* const* value, size_t size, uint8_t columns) {
+        if ((value == nullptr && size != 0) || size > max_keys || columns == 0) {
+            return uix_result::invalid_argument;
+        }
+        press(-1);
+        for (size_t i = 0; i < size; ++i) {
+            m_keys[i].text = value[i];
+            m_keys[i].label_size = {0, 0};
+        }
+        m_keys_size = size;
+        m_columns = columns;
+        m_faces_dirty = true;
+        m_labels_dirty = true;
+        this->invalidate();
+        return uix_result::success;
+    }
+    /// @brief Indicates the number of keys, including empty cells
+    /// @return The number of keys
+    size_t keys_size() const {
+        return m_keys_size;
+    }
+    /// @brief Indicates the label of a key
+    /// @param index The index of the key
+    /// @return The label, or null if the cell is empty
+    const char* key(size_t index) const {
+        return index < m_keys_size ? m_keys[index].text : nullptr;
+    }
+    /// @brief Indicates the number of keys in each row
+    /// @return The number of columns
+    uint8_t columns() const {
+        return m_columns;
+    }
+    /// @brief Finds the key at a location
+    /// @param location The location in control coordinates
+    /// @return The index of the key, or -1 if there is no key there
+    int key_at(spoint16 location) const {
+        const ssize16 cell = cell_size();
+        if (cell.width <= 0 || cell.height <= 0 || location.x < 0 || location.y < 0) {
+            return -1;
+        }
+        const int c = location.x / cell.width;
+        const int r = location.y / cell.height;
+        if (c >= m_columns || r >= rows()) {
+            return -1;
+        }
+        const size_t i = (size_t)r * m_columns + c;
+        if (i >= m_keys_size || m_keys[i].text == nullptr) {
+            return -1;
+        }
+        return (int)i;
+    }
+    /// @brief Indicates where a key is drawn
+    /// @param index The index of the key
+    /// @return The bounds of the key in control coordinates
+    srect16 key_bounds(size_t index) const {
+        const ssize16 cell = cell_size();
+        const int16_t x1 = (int16_t)((index % m_columns) * cell.width);
+        const int16_t y1 = (int16_t)((index / m_columns) * cell.height);
+        return srect16(x1 + m_margin, y1 + m_margin, x1 + cell.width - 1 - m_margin, y1 + cell.height - 1 - m_margin);
+    }
+    /// @brief Indicates the key being pressed
+    /// @return The index of the key, or -1 if none is pressed
+    int pressed_key() const {
+        return m_pressed;
+    }
+    /// @brief Indicates the font used for the labels
+    /// @return The font stream
+    const io::stream& font() const {
+        return *m_text_info.ttf_font;
+    }
+    /// @brief Sets the font used for the labels
+    /// @param value The font stream
+    void font(io::stream& value) {
+        m_text_info.ttf_font = &value;
+        m_labels_dirty = true;
+        this->invalidate();
+    }
+    /// @brief Indicates font size
+    /// @return The height of the font, in pixels
+    uint16_t font_size() const {
+        return m_text_info.font_size + 0.5f;
+    }
+    /// @brief Sets size of the font
+    /// @param value The font height in pixels
+    void font_size(uint16_t value) {
+        m_text_info.font_size = value;
+        m_labels_dirty = true;
+        this->invalidate();
+    }
+    /// @brief Indicates the character encoding (Unicode capable fonts only)
+    /// @return The character encoding
+    const text_encoder* text_encoding() const {
+        return m_text_info.encoding;
+    }
+    /// @brief Sets the character encoding (Unicode capable fonts only)
+    /// @param value The character encoding
+    void text_encoding(const text_encoder* value) {
+        if (m_text_info.encoding != value) {
+            m_text_info.encoding = value;
+            m_labels_dirty = true;
+            this->invalidate();
+        }
+    }
+    /// @brief Indicates the label color of the keys
+    /// @return The RGBA8888 color
+    gfx::rgba_pixel<32> color() const {
+        return m_color;
+    }
+    /// @brief Sets the label color of the keys
+    /// @param value The RGBA8888 color
+    void color(gfx::rgba_pixel<32> value) {
+        m_color = value;
+        this->invalidate();
+    }
+    /// @brief Indicates the background color of the keys
+    /// @return The RGBA8888 color
+    gfx::rgba_pixel<32> background_color() const {
+        return m_background_color;
+    }
+    /// @brief Sets the background color of the keys
+    /// @param value The RGBA8888 color
+    void background_color(gfx::rgba_pixel<32> value) {
+        m_background_color = value;
+        this->invalidate();
+    }
+    /// @brief Indicates the border color of the keys
+    /// @return The RGBA8888 color
+    gfx::rgba_pixel<32> border_color() const {
+        return m_border_color;
+    }
+    /// @brief Sets the border color of the keys
+    /// @param value The RGBA8888 color
+    void border_color(gfx::rgba_pixel<32> value) {
+        m_border_color = value;
+        this->invalidate();
+    }
+    /// @brief Indicates the label color of a pressed key
+    /// @return The RGBA8888 color
+    gfx::rgba_pixel<32> pressed_color() const {
+        return m_pressed_color;
+    }
+    /// @brief Sets the label color of a pressed key
+    /// @param value The RGBA8888 color
+    void pressed_color(gfx::rgba_pixel<32> value) {
+        m_pressed_color = value;
+        if (m_pressed != -1) {
+            this->invalidate(key_bounds(m_pressed));
+        }
+    }
+    /// @brief Indicates the background color of a pressed key
+    /// @return The RGBA8888 color
+    gfx::rgba_pixel<32> pressed_background_color() const {
+        return m_pressed_background_color;
+    }
+    /// @brief Sets the background color of a pressed key
+    /// @param value The RGBA8888 color
+    void pressed_background_color(gfx::rgba_pixel<32> value) {
+        m_pressed_background_color = value;
+        if (m_pressed != -1) {
+            this->invalidate(key_bounds(m_pressed));
+        }
+    }
+    /// @brief Indicates the border width of the keys
+    /// @return The width in pixels
+    uint16_t border_width() const {
+        return m_border_width;
+    }
+    /// @brief Sets the border width of the keys
+    /// @param value The width in pixels
+    void border_width(uint16_t value) {
+        m_border_width = value;
+        m_faces_dirty = true;
+        this->invalidate();
+    }
+    /// @brief Indicates the radiuses of the key corners
+    /// @return The radiuses in pixels
+    size16 radiuses() const {
+        return m_radiuses;
+    }
+    /// @brief Sets the radiuses of the key corners
+    /// @param value The radiuses in pixels
+    void radiuses(size16 value) {
+        m_radiuses = value;
+        m_faces_dirty = true;
+        this->invalidate();
+    }
+    /// @brief Indicates the space around each key within its cell
+    /// @return The margin in pixels
+    uint16_t margin() const {
+        return m_margin;
+    }
+    /// @brief Sets the space around each key within its cell
+    /// @param value The margin in pixels
+    void margin(uint16_t value) {
+        m_margin = value;
+        m_faces_dirty = true;
+        this->invalidate();
+    }
+    /// @brief Retrieves the key pressed changed callback
+    /// @return A pointer to the callback
+    on_key_pressed_changed_callback_type on_key_pressed_changed_callback() const {
+        return m_on_key_pressed_changed_callback;
+    }
+    /// @brief Retrieves the key pressed changed callback state
+    /// @return The callback state
+    void* on_key_pressed_changed_callback_state() const {
+        return m_on_key_pressed_changed_callback_state;
+    }
+    /// @brief Sets the key pressed changed callback, which is triggered when a key is pressed or released
+    /// @param callback The callback
+    /// @param state A user defined value passed to the callback
+    void on_key_pressed_changed_callback(on_key_pressed_changed_callback_type callback, void* state = nullptr) {
+        m_on_key_pressed_changed_callback = callback;
+        m_on_key_pressed_changed_callback_state = state;
+    }
+};
+}  // namespace uix
+#endif  // HTCW_UIX_KEYPAD_HPP
@@ -1,6 +1,8 @@
 #ifndef HTCW_UIX_LABEL_HPP
 #define HTCW_UIX_LABEL_HPP
 #include "uix_core.hpp"
+#include "uix_glyph_atlas.hpp"
+#include "uix_text_layout.hpp"
 namespace uix {
     /// @brief Represents a text label
     /// @tparam ControlSurfaceType The control surfice type, usually from the screen
@@ -13,15 +15,99 @@ namespace uix {
         using palette_type = typename ControlSurfaceType::palette_type;
         using control_surface_type = ControlSurfaceType;
         typedef void(*on_pressed_changed_callback_type)(bool pressed,void* state);
+        /// @brief The most lines the label keeps a layout for. Longer text is drawn as a whole.
+        constexpr static const size_t max_lines = text_layout::max_lines;
     private:
         ssize16 m_padding;
         uix_justify m_text_justify;
         gfx::text_info m_text_info;
         gfx::rgba_pixel<32> m_color;
+        typename base_type::native_color_type m_native_color;
         srect16 m_text_rect;
+        // the layout lives in the shared cache, which is asked again if it has been evicted
+        const text_layout* m_layout;
+        uint32_t m_layout_stamp;
+        // draws in the native pixel when the color is opaque, so it isn't converted for every glyph
+        void draw_text(control_surface_type& destination,const srect16& rect,const gfx::text_info& ti,const srect16& clip) {
+            pixel_type px;
+            if(m_color.opacity()==1.f && gfx::gfx_result::success==m_native_color.get(destination,m_color,&px)) {
+                gfx::draw::text(destination,rect,ti,px,&clip);
+            } else {
+                gfx::draw::text(destination,rect,ti,m_color,&clip);
+            }
+        }
         bool is_valid() {
             return m_text_info.text!=nullptr && m_text_info.text_font!=nullptr && m_text_info.encoding!=nullptr && m_text_info.text_byte_count!=0;
         }
+        // the area the text is justified within, or false if the padding leaves no room for it
+        bool text_bounds(srect16* out_bounds) const {
+            srect16 b=(srect16)this->dimensions().bounds();
+            b.inflate_inplace(-1,-1);
+            if(b.height()>m_padding.height*2 && b.width()>m_padding.width*2) {
+                srect16 bb = b.inflate(-m_padding.width,-m_padding.height);
+                if(bb.height()>=1) {
+                    *out_bounds = b;
+                    return true;
+                }
+            }
+            return false;
+        }
+        void acquire_caches(gfx::text_info& ti) {
+            glyph_atlas* atlas = this->text_glyph_atlas();
+            if(atlas!=nullptr && ti.draw_cache==nullptr && ti.measure_cache==nullptr) {
+                // the caches are looked up every time, since the atlas may evict them in between
+                atlas->acquire(*ti.text_font,&ti.draw_cache,&ti.measure_cache);
+            }
+        }
+        void layout_text(const gfx::text_info& ti,const srect16& b) {
+            // strings shown before are laid out from the cache instead of measured again
+            m_layout = default_text_layout_cache().layout(ti,&m_layout_stamp);
+            m_text_rect = (srect16)m_layout->size.bounds();
+            switch(m_text_justify) {
+                case uix_justify::top_middle:
+                    m_text_rect.center_horizontal_inplace((srect16)b);
+                    break;
+                case uix_justify::top_right:
+                    m_text_rect.offset_inplace(b.width()-m_text_rect.width(),0);
+                    break;
+                case uix_justify::center_left:
+                    m_text_rect.center_vertical_inplace((srect16)b);
+                    break;
+                case uix_justify::center:
+                    m_text_rect.center_inplace((srect16)b);
+                    break;
+                case uix_justify::center_right:
+                    m_text_rect.center_vertical_inplace((srect16)b);
+                    m_text_rect.offset_inplace(b.width()-m_text_rect.width(),0);
+                    break;
+                case uix_justify::bottom_left:
+                    m_text_rect.offset_inplace(0,b.height()-m_text_rect.height());
+                    break;
+                case uix_justify::bottom_middle:
+                    m_text_rect.center_horizontal_inplace((srect16)b);
+                    m_text_rect.offset_inplace(0,b.height()-m_text_rect.height());
+                    break;
+                case uix_justify::bottom_right:
+                    m_text_rect.offset_inplace(b.width()-m_text_rect.width(),b.height()-m_text_rect.height());
+                    break;
+                default: // top left
+                    break;
+            }
+        }
+        // invalidates only where the old and the new text were, when the old text was laid out
+        void invalidate_text() {
+            srect16 b;
+            if(!(m_text_rect.x1==0&&m_text_rect.y1==0&&m_text_rect.x2==0&&m_text_rect.y2==0) && is_valid() && text_bounds(&b)) {
+                const srect16 old_rect = m_text_rect;
+                gfx::text_info ti = m_text_info;
+                acquire_caches(ti);
+                layout_text(ti,b);
+                this->invalidate(old_rect,m_text_rect);
+                return;
+            }
+            m_text_rect = {0,0,0,0};
+            this->invalidate();
+        }
     protected:
         void do_move_control(label& rhs) {
             this->base_type::do_move_control(rhs);
@@ -30,6 +116,8 @@ namespace uix {
             m_text_info = rhs.m_text_info;
             m_color = rhs.m_color;
             m_text_rect = rhs.m_text_rect;
+            m_layout = rhs.m_layout;
+            m_layout_stamp = rhs.m_layout_stamp;
         }
         void do_copy_control(const label& rhs) {
             this->base_type::do_copy_control(rhs);
@@ -38,6 +126,8 @@ namespace uix {
             m_text_info = rhs.m_text_info;
             m_color = rhs.m_color;
             m_text_rect = rhs.m_text_rect;
+            m_layout = rhs.m_layout;
+            m_layout_stamp = rhs.m_layout_stamp;
         }
     public:
         /// @brief Moves a label
@@ -67,7 +157,7 @@ namespace uix {
         /// @brief Constructs a new instance of a label with the specified parent and optional palette
         /// @param parent The parent. Usually this is the screen
         /// @param palette The palette, if any. This is usually taken from the screen
-        label(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent,palette), m_padding(4,4),m_text_justify(uix_justify::center), m_text_rect(0,0,0,0) {
+        label(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent,palette), m_padding(4,4),m_text_justify(uix_justify::center), m_text_rect(0,0,0,0), m_layout(nullptr), m_layout_stamp(0) {
             constexpr static const auto white = gfx::rgba_pixel<32>(0xFF,0xFF,0xFF,0xFF);
             color(white);
             m_text_info.text_font = nullptr;
@@ -75,7 +165,7 @@ namespace uix {
             
         }
         /// @brief Constructs a new instance of a label with the specified parent and optional palette
-        label() : base_type(), m_padding(4,4),m_text_justify(uix_justify::center), m_text_rect(0,0,0,0) {
+        label() : base_type(), m_padding(4,4),m_text_justify(uix_justify::center), m_text_rect(0,0,0,0), m_layout(nullptr), m_layout_stamp(0) {
             constexpr static const auto white = gfx::rgba_pixel<32>(0xFF,0xFF,0xFF,0xFF);
             color(white);
         }
@@ -93,8 +183,7 @@ namespace uix {
         /// @param value 
         void text(const char* value) {
             m_text_info.text_sz(value);
-            m_text_rect = {0,0,0,0};
-            this->invalidate();
+            invalidate_text();
         }
         /// @brief Sets the text of the label
         /// @param value the raw text data
@@ -102,8 +191,7 @@ namespace uix {
         void text(const gfx::text_handle value, size_t byte_count) {
             m_text_info.text=value;
             m_text_info.text_byte_count = byte_count;
-            m_text_rect = {0,0,0,0};
-            this->invalidate();
+            invalidate_text();
         }
         /// @brief Indicates the padding around the text
         /// @return A ssize16 indicating the padding
@@ -171,7 +259,7 @@ namespace uix {
         gfx::font_draw_cache* draw_cache() const {
             return m_text_info.draw_cache;
         }
-        /// @brief Sets the draw cache
+        /// @brief Sets the draw cache. If neither cache is set, the label uses the screen's glyph atlas
         /// @param value The draw cache for this font
         void draw_cache(gfx::font_draw_cache* value) {
             m_text_info.draw_cache = value;
@@ -205,6 +293,8 @@ namespace uix {
         /// @param value The tab width for this font
         void tab_width(uint16_t value) {
             m_text_info.tab_width = value;
+            m_text_rect = {0,0,0,0};
+            this->invalidate();
         }
         
         /// @brief Draws the label
@@ -212,52 +302,35 @@ namespace uix {
         /// @param clip The clipping rectangle
         virtual void on_paint(control_surface_type& destination,const srect16& clip) override {
             base_type::on_paint(destination,clip);
-            gfx::rgba_pixel<32> color;
-            srect16 b=(srect16)this->dimensions().bounds();
-            b=srect16(b.x1,b.y1,b.x2,b.y2);
-            color = m_color;
-            b.inflate_inplace(-1,-1);
-            if(b.height()>m_padding.height*2 && b.width()>m_padding.width*2) {
-                srect16 bb = b.inflate(-m_padding.width,-m_padding.height);
-                if(bb.height()>=1 && is_valid()) {
-                    if(m_text_rect.x1==0&&m_text_rect.y1==0&&m_text_rect.x2==0&&m_text_rect.y2==0) {
-                        size16 sz;
-                        m_text_info.text_font->measure(uint16_t(-1),m_text_info,&sz);
-                        m_text_rect = (srect16)sz.bounds();
-                        switch(m_text_justify) {
-                            case uix_justify::top_middle:
-                                m_text_rect.center_horizontal_inplace((srect16)b);
-                                break;
-                            case uix_justify::top_right:
-                                m_text_rect.offset_inplace(b.width()-m_text_rect.width(),0);
-                                break;
-                            case uix_justify::center_left:
-                                m_text_rect.center_vertical_inplace((srect16)b);
-                                break;
-                            case uix_justify::center:
-                                m_text_rect.center_inplace((srect16)b);
-                                break;
-                            case uix_justify::center_right:
-                                m_text_rect.center_vertical_inplace((srect16)b);
-                                m_text_rect.offset_inplace(b.width()-m_text_rect.width(),0);
-                                break;
-                            case uix_justify::bottom_left:
-                                m_text_rect.offset_inplace(0,b.height()-m_text_rect.height());
-                                break;
-                            case uix_justify::bottom_middle:
-                                m_text_rect.center_horizontal_inplace((srect16)b);
-                                m_text_rect.offset_inplace(0,b.height()-m_text_rect.height());
-                                break;
-                            case uix_justify::bottom_right:
-                                m_text_rect.offset_inplace(b.width()-m_text_rect.width(),b.height()-m_text_rect.height());
-                                break;
-                            default: // top left
+            srect16 b;
+            if(text_bounds(&b) && is_valid()) {
+                gfx::text_info ti = m_text_info;
+                acquire_caches(ti);
+                if(m_text_rect.x1==0&&m_text_rect.y1==0&&m_text_rect.x2==0&&m_text_rect.y2==0) {
+                    layout_text(ti,b);
+                } else if(m_layout==nullptr || !default_text_layout_cache().valid(m_layout,m_layout_stamp)) {
+                    m_layout = default_text_layout_cache().layout(ti,&m_layout_stamp);
+                }
+                if(clip.intersects(m_text_rect)) {
+                    if(m_layout->lines_size==0) {
+                        draw_text(destination,m_text_rect,ti,clip);
+                    } else {
+                        // only lay down the lines that touch the clip, so tiles don't walk the whole text
+                        const char* sz = (const char*)ti.text;
+                        for(size_t i = 0;i<m_layout->lines_size;++i) {
+                            const text_layout::line& l = m_layout->lines[i];
+                            const srect16 lr(m_text_rect.x1,m_text_rect.y1+l.y1,m_text_rect.x1+l.x2,m_text_rect.y1+l.y2);
+                            if(lr.y1>clip.y2) {
                                 break;
+                            }
+                            if(l.x2<0 || !clip.intersects(lr)) {
+                                continue;
+                            }
+                            ti.text = sz+l.offset;
+                            ti.text_byte_count = l.byte_count;
+                            draw_text(destination,srect16(lr.x1,lr.y1,m_text_rect.x2,m_text_rect.y2),ti,clip);
                         }
                     }
-                    if(clip.intersects(m_text_rect)) {
-                        gfx::draw::text(destination,m_text_rect,m_text_info,color,&clip);
-                    }
                 }
             }
         }
@@ -0,0 +1,153 @@
+#ifndef HTCW_UIX_MASK_HPP
+#define HTCW_UIX_MASK_HPP
+#include "uix_core.hpp"
+#include "uix_canvas_control.hpp"
+namespace uix {
+/// @brief An 8-bit coverage mask holding a rasterized vector shape, so it can be painted in any color without being rasterized again
+class coverage_mask final {
+   public:
+    /// @brief The type of bitmap used to paint the mask
+    using bitmap_type = gfx::const_bitmap<gfx::alpha_pixel<8>>;
+    /// @brief The callback type for drawing the shape. Shapes should be filled and/or stroked with coverage_mask::ink
+    typedef void (*on_render_callback_type)(gfx::canvas& destination, void* state);
+    /// @brief The color to draw shapes in when rendering the mask
+    constexpr static const gfx::vector_pixel ink = gfx::vector_pixel(255, 255, 255, 255);
+
+   private:
+    uint8_t* m_buffer;
+    size16 m_dimensions;
+    void* (*m_allocator)(size_t);
+    void (*m_deallocator)(void*);
+    coverage_mask(const coverage_mask& rhs) = delete;
+    coverage_mask& operator=(const coverage_mask& rhs) = delete;
+    void do_move(coverage_mask& rhs) {
+        clear();
+        m_buffer = rhs.m_buffer;
+        rhs.m_buffer = nullptr;
+        m_dimensions = rhs.m_dimensions;
+        rhs.m_dimensions = {0, 0};
+        m_allocator = rhs.m_allocator;
+        m_deallocator = rhs.m_deallocator;
+    }
+
+   public:
+    /// @brief Constructs an empty mask
+    /// @param allocator The allocator for the mask memory
+    /// @param deallocator The deallocator for the mask memory
+    coverage_mask(void*(allocator)(size_t) = ::malloc, void(deallocator)(void*) = ::free) : m_buffer(nullptr), m_dimensions(0, 0), m_allocator(allocator), m_deallocator(deallocator) {
+    }
+    /// @brief Moves a mask
+    /// @param rhs The mask to move
+    coverage_mask(coverage_mask&& rhs) : m_buffer(nullptr) {
+        do_move(rhs);
+    }
+    /// @brief Moves a mask
+    /// @param rhs The mask to move
+    /// @return this
+    coverage_mask& operator=(coverage_mask&& rhs) {
+        do_move(rhs);
+        return *this;
+    }
+    /// @brief Destroys the mask
+    ~coverage_mask() {
+        clear();
+    }
+    /// @brief Indicates whether the mask holds a rendered shape
+    /// @return True if the mask has been rendered, otherwise false
+    bool valid() const {
+        return m_buffer != nullptr;
+    }
+    /// @brief Indicates the dimensions of the mask
+    /// @return The width and height
+    size16 dimensions() const {
+        return m_dimensions;
+    }
+    /// @brief Provides access to the coverage values, one byte per pixel
+    /// @return A pointer to the first row
+    const uint8_t* begin() const {
+        return m_buffer;
+    }
+    /// @brief Releases the mask memory
+    void clear() {
+        if (m_buffer != nullptr) {
+            m_deallocator(m_buffer);
+            m_buffer = nullptr;
+        }
+        m_dimensions = {0, 0};
+    }
+    /// @brief Sets up a canvas style for drawing a mask layer in ink
+    /// @param destination The canvas being rendered to the mask
+    /// @param fill True to fill shapes
+    /// @param stroke_width The width of the stroke, or 0 for none
+    static void ink_style(gfx::canvas& destination, bool fill, float stroke_width = 0.f) {
+        gfx::canvas_style si = destination.style();
+        si.fill_paint_type = fill ? gfx::paint_type::solid : gfx::paint_type::none;
+        si.fill_color = ink;
+        si.stroke_paint_type = stroke_width > 0.f ? gfx::paint_type::solid : gfx::paint_type::none;
+        si.stroke_color = ink;
+        si.stroke_width = stroke_width;
+        destination.style(si);
+    }
+    /// @brief Indicates whether a color paints the same from a mask as it does through the canvas. Translucent colors do not.
+    /// @param color The color
+    /// @return True if the color is opaque or fully transparent, otherwise false
+    template <typename Color>
+    static bool paintable(Color color) {
+        const float o = color.opacity();
+        return o == 0.f || o == 1.f;
+    }
+    /// @brief Rasterizes a shape into the mask
+    /// @param dimensions The size of the mask
+    /// @param callback The callback that draws the shape
+    /// @param state The user defined state to pass to the callback
+    /// @param pool The pool to borrow the rasterizing canvas from
+    /// @return The result of the operation
+    uix_result render(size16 dimensions, on_render_callback_type callback, void* state, canvas_pool& pool = default_canvas_pool()) {
+        if (dimensions.width == 0 || dimensions.height == 0 || callback == nullptr) {
+            clear();
+            return uix_result::invalid_argument;
+        }
+        const size_t size = (size_t)dimensions.width * dimensions.height;
+        if (m_buffer == nullptr || m_dimensions.width != dimensions.width || m_dimensions.height != dimensions.height) {
+            clear();
+            m_buffer = (uint8_t*)m_allocator(size);
+            if (m_buffer == nullptr) {
+                return uix_result::out_of_memory;
+            }
+            m_dimensions = dimensions;
+        }
+        memset(m_buffer, 0, size);
+        gfx::canvas* cvs = pool.acquire(dimensions);
+        if (cvs == nullptr) {
+            clear();
+            return uix_result::out_of_memory;
+        }
+        // white on black in 8-bit gray is the coverage itself
+        gfx::bitmap<gfx::gray_pixel<8>> bmp(dimensions, m_buffer);
+        helpers::clipped_target<gfx::bitmap<gfx::gray_pixel<8>>> target(bmp, dimensions);
+        gfx::draw::canvas(target, *cvs, point16::zero(), nullptr);
+        callback(*cvs, state);
+        pool.release(cvs);
+        return uix_result::success;
+    }
+    /// @brief Paints the mask in a color
+    /// @tparam Destination The type of the draw destination
+    /// @tparam Color The type of the color
+    /// @param destination The destination to draw to
+    /// @param location Where to place the top left of the mask
+    /// @param color The color to paint the covered pixels
+    /// @param clip The clipping rectangle, if any
+    /// @return The result of the operation
+    template <typename Destination, typename Color>
+    gfx::gfx_result paint(Destination& destination, spoint16 location, Color color, const srect16* clip = nullptr) const {
+        if (m_buffer == nullptr || color.opacity() == 0) {
+            return gfx::gfx_result::success;
+        }
+        gfx::rgba_pixel<32> px;
+        convert(color, &px);
+        const bitmap_type bmp(m_dimensions, m_buffer);
+        return gfx::draw::icon(destination, location, bmp, px, gfx::rgba_pixel<32>(0, 0, 0, 255), true, false, clip);
+    }
+};
+}  // namespace uix
+#endif  // HTCW_UIX_MASK_HPP
@@ -0,0 +1,254 @@
+#ifndef HTCW_UIX_NINE_SLICE_HPP
+#define HTCW_UIX_NINE_SLICE_HPP
+#include "uix_core.hpp"
+#include "uix_mask.hpp"
+namespace uix {
+/// @brief A pre-rendered rounded rectangle which can be stretched to any size of at least twice its corners.
+/// The anti-aliased corners are drawn from coverage masks, while the edges and interior are span fills.
+class nine_slice_skin final {
+    coverage_mask m_fill;
+    coverage_mask m_border;
+    size16 m_radiuses;
+    uint16_t m_inset;
+    float m_border_width;
+    size16 m_corner;
+    nine_slice_skin(const nine_slice_skin& rhs) = delete;
+    nine_slice_skin& operator=(const nine_slice_skin& rhs) = delete;
+    static void render_fill(gfx::canvas& dst, void* state) {
+        nine_slice_skin* t = (nine_slice_skin*)state;
+        coverage_mask::ink_style(dst, true);
+        dst.rounded_rectangle(t->shape_bounds(), (sizef)t->m_radiuses);
+        dst.render();
+    }
+    static void render_border(gfx::canvas& dst, void* state) {
+        nine_slice_skin* t = (nine_slice_skin*)state;
+        coverage_mask::ink_style(dst, false, t->m_border_width);
+        dst.rounded_rectangle(t->shape_bounds(), (sizef)t->m_radiuses);
+        dst.render();
+    }
+    rectf shape_bounds() const {
+        rectf result(0, 0, m_corner.width * 2, m_corner.height * 2);
+        result.inflate_inplace(-m_inset, -m_inset);
+        return result;
+    }
+    template <typename Destination, typename Color>
+    static void span(Destination& destination, const srect16& rect, Color color, uint8_t coverage, const srect16* clip) {
+        if (coverage == 0 || !rect.intersects(*clip)) {
+            return;
+        }
+        gfx::rgba_pixel<32> px;
+        convert(color, &px);
+        if (coverage != 255) {
+            px.template channel<gfx::channel_name::A>(coverage);
+        }
+        gfx::draw::filled_rectangle(destination, rect, px, clip);
+    }
+    template <typename Destination, typename Color>
+    static void layer(Destination& destination, const coverage_mask& mask, const srect16& bounds, size16 corner, Color color, const srect16* clip) {
+        if (!mask.valid() || color.opacity() == 0) {
+            return;
+        }
+        const size16 sz = mask.dimensions();
+        const uint8_t* cov = mask.begin();
+        const int16_t w = bounds.width(), h = bounds.height();
+        const int16_t x = bounds.x1, y = bounds.y1;
+        const int16_t cw = corner.width, ch = corner.height;
+        // corners: the whole mask, clipped down to each corner
+        const srect16 corners[] = {
+            srect16(x, y, x + cw - 1, y + ch - 1),
+            srect16(x + w - cw, y, x + w - 1, y + ch - 1),
+            srect16(x, y + h - ch, x + cw - 1, y + h - 1),
+            srect16(x + w - cw, y + h - ch, x + w - 1, y + h - 1)};
+        const spoint16 locations[] = {
+            spoint16(x, y),
+            spoint16(x + w - sz.width, y),
+            spoint16(x, y + h - sz.height),
+            spoint16(x + w - sz.width, y + h - sz.height)};
+        for (int i = 0; i < 4; ++i) {
+            if (corners[i].intersects(*clip)) {
+                const srect16 cr = corners[i].crop(*clip);
+                mask.paint(destination, locations[i], color, &cr);
+            }
+        }
+        // edges: the middle row and column of the mask, stretched
+        for (int16_t i = 0; i < ch; ++i) {
+            span(destination, srect16(x + cw, y + i, x + w - cw - 1, y + i), color, cov[i * sz.width + cw], clip);
+            span(destination, srect16(x + cw, y + h - ch + i, x + w - cw - 1, y + h - ch + i), color, cov[(ch + 1 + i) * sz.width + cw], clip);
+        }
+        for (int16_t i = 0; i < cw; ++i) {
+            span(destination, srect16(x + i, y + ch, x + i, y + h - ch - 1), color, cov[ch * sz.width + i], clip);
+            span(destination, srect16(x + w - cw + i, y + ch, x + w - cw + i, y + h - ch - 1), color, cov[ch * sz.width + cw + 1 + i], clip);
+        }
+        // interior
+        span(destination, srect16(x + cw, y + ch, x + w - cw - 1, y + h - ch - 1), color, cov[ch * sz.width + cw], clip);
+    }
+
+   public:
+    /// @brief Constructs an empty skin
+    nine_slice_skin() : m_radiuses(0, 0), m_inset(0), m_border_width(0), m_corner(0, 0) {
+    }
+    /// @brief Indicates whether the skin has been rendered
+    /// @return True if the skin is ready to paint, otherwise false
+    bool valid() const {
+        return m_fill.valid();
+    }
+    /// @brief Indicates whether the skin was rendered with the given geometry
+    /// @param radiuses The corner radiuses
+    /// @param inset The distance from the edge of the bounds to the edge of the shape
+    /// @param border_width The stroke width of the border, or 0 for none
+    /// @return True if the skin matches, otherwise false
+    bool matches(size16 radiuses, uint16_t inset, float border_width) const {
+        return valid() && m_radiuses.width == radiuses.width && m_radiuses.height == radiuses.height &&
+               m_inset == inset && m_border_width == border_width;
+    }
+    /// @brief Indicates whether the skin can be stretched to the given size
+    /// @param dimensions The size of the area to paint
+    /// @return True if the area is at least as large as the corners, otherwise false
+    bool fits(size16 dimensions) const {
+        return valid() && dimensions.width > m_corner.width * 2 && dimensions.height > m_corner.height * 2;
+    }
+    /// @brief Releases the skin memory
+    void clear() {
+        m_fill.clear();
+        m_border.clear();
+        m_corner = {0, 0};
+    }
+    /// @brief Rasterizes the corners of a rounded rectangle
+    /// @param radiuses The corner radiuses
+    /// @param inset The distance from the edge of the bounds to the edge of the shape
+    /// @param border_width The stroke width of the border, or 0 for none
+    /// @param pool The pool to borrow the rasterizing canvas from
+    /// @return The result of the operation
+    uix_result render(size16 radiuses, uint16_t inset, float border_width, canvas_pool& pool = default_canvas_pool()) {
+        m_radiuses = radiuses;
+        m_inset = inset;
+        m_border_width = border_width;
+        // a corner spans the inset, the curve and the outer half of the stroke
+        const uint16_t stroke = (uint16_t)ceilf(border_width * .5f);
+        m_corner = size16(inset + radiuses.width + stroke + 1, inset + radiuses.height + stroke + 1);
+        const size16 sz(m_corner.width * 2 + 1, m_corner.height * 2 + 1);
+        uix_result res = m_fill.render(sz, render_fill, this, pool);
+        if (res != uix_result::success) {
+            clear();
+            return res;
+        }
+        m_border.clear();
+        if (border_width > 0.f) {
+            res = m_border.render(sz, render_border, this, pool);
+            if (res != uix_result::success) {
+                clear();
+                return res;
+            }
+        }
+        return uix_result::success;
+    }
+    /// @brief Paints the skin stretched over an area
+    /// @tparam Destination The type of the draw destination
+    /// @tparam Color The type of the colors
+    /// @param destination The destination to draw to
+    /// @param bounds The area to cover. Must fit()
+    /// @param background_color The fill color
+    /// @param border_color The border color
+    /// @param clip The clipping rectangle
+    template <typename Destination, typename Color>
+    void paint(Destination& destination, const srect16& bounds, Color background_color, Color border_color, const srect16& clip) const {
+        layer(destination, m_fill, bounds, m_corner, background_color, &clip);
+        layer(destination, m_border, bounds, m_corner, border_color, &clip);
+    }
+};
+/// @brief A small shared cache of nine slice skins, so that controls with the same corners share one rasterization
+class nine_slice_atlas final {
+   public:
+    /// @brief The maximum number of skins an atlas can hold
+    constexpr static const size_t max_capacity = 8;
+
+   private:
+    struct entry {
+        nine_slice_skin skin;
+        size_t refs;
+        uint32_t age;
+    };
+    entry m_entries[max_capacity];
+    uint32_t m_age;
+    canvas_pool* m_pool;
+    nine_slice_atlas(const nine_slice_atlas& rhs) = delete;
+    nine_slice_atlas& operator=(const nine_slice_atlas& rhs) = delete;
+    nine_slice_atlas(nine_slice_atlas&& rhs) = delete;
+    nine_slice_atlas& operator=(nine_slice_atlas&& rhs) = delete;
+
+   public:
+    /// @brief Constructs a new atlas
+    /// @param pool The pool to borrow rasterizing canvases from
+    nine_slice_atlas(canvas_pool& pool = default_canvas_pool()) : m_age(0), m_pool(&pool) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            m_entries[i].refs = 0;
+            m_entries[i].age = 0;
+        }
+    }
+    /// @brief Borrows a skin with the given geometry, rendering it if necessary
+    /// @param radiuses The corner radiuses
+    /// @param inset The distance from the edge of the bounds to the edge of the shape
+    /// @param border_width The stroke width of the border, or 0 for none
+    /// @return The skin, or null if the atlas is full of skins in use or the skin could not be rendered
+    const nine_slice_skin* acquire(size16 radiuses, uint16_t inset, float border_width) {
+        entry* victim = nullptr;
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (e.skin.matches(radiuses, inset, border_width)) {
+                ++e.refs;
+                e.age = ++m_age;
+                return &e.skin;
+            }
+            // prefer an empty entry, otherwise the least recently used unreferenced one
+            if (e.refs == 0 && (victim == nullptr ||
+                                (victim->skin.valid() && (!e.skin.valid() || e.age < victim->age)))) {
+                victim = &e;
+            }
+        }
+        if (victim == nullptr) {
+            return nullptr;
+        }
+        if (uix_result::success != victim->skin.render(radiuses, inset, border_width, *m_pool)) {
+            return nullptr;
+        }
+        victim->refs = 1;
+        victim->age = ++m_age;
+        return &victim->skin;
+    }
+    /// @brief Returns a skin borrowed with acquire(). Unreferenced skins stay rendered until their slot is needed.
+    /// @param skin The skin
+    void release(const nine_slice_skin* skin) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            if (&e.skin == skin) {
+                if (e.refs > 0) {
+                    --e.refs;
+                }
+                return;
+            }
+        }
+    }
+    /// @brief Frees every skin not currently borrowed
+    void clear() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (m_entries[i].refs == 0) {
+                m_entries[i].skin.clear();
+            }
+        }
+    }
+};
+namespace helpers {
+template <bool Dummy>
+struct nine_slice_atlas_shared {
+    static nine_slice_atlas atlas;
+};
+template <bool Dummy>
+nine_slice_atlas nine_slice_atlas_shared<Dummy>::atlas;
+}  // namespace helpers
+/// @brief Retrieves the atlas used by skinned controls unless told otherwise
+/// @return The shared atlas
+inline nine_slice_atlas& default_nine_slice_atlas() {
+    return helpers::nine_slice_atlas_shared<true>::atlas;
+}
+}  // namespace uix
+#endif  // HTCW_UIX_NINE_SLICE_HPP
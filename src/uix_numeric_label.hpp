@@ -0,0 +1,315 @@
+#ifndef HTCW_UIX_NUMERIC_LABEL_HPP
+#define HTCW_UIX_NUMERIC_LABEL_HPP
+#include <stdio.h>
+#include "uix_core.hpp"
+namespace uix {
+    /// @brief Represents a label for numbers that redraws only the characters that change. Each character sits in a fixed width cell,
+    /// and the cells are right justified and vertically centered in the control. With an opaque background, the digits and punctuation
+    /// are rendered once into a strip, and cells are painted by copying from it.
+    /// @tparam ControlSurfaceType The control surface type, usually from the screen
+    template<typename ControlSurfaceType>
+    class numeric_label final : public control<ControlSurfaceType> {
+    public:
+        using type = numeric_label;
+        using base_type = control<ControlSurfaceType>;
+        using pixel_type = typename ControlSurfaceType::pixel_type;
+        using palette_type = typename ControlSurfaceType::palette_type;
+        using control_surface_type = ControlSurfaceType;
+        /// @brief The most characters the label can show
+        constexpr static const size_t max_length = 16;
+    private:
+        using bitmap_type = gfx::bitmap<pixel_type,palette_type>;
+        constexpr static const size_t characters_size = 17;
+        static const char* characters() {
+            return "0123456789 +-.,:%";
+        }
+        const gfx::font* m_font;
+        gfx::rgba_pixel<32> m_color;
+        gfx::rgba_pixel<32> m_background_color;
+        char m_cells[max_length];
+        size_t m_cell_count;
+        int16_t m_cell_width;
+        void* (*m_allocator)(size_t);
+        void (*m_deallocator)(void*);
+        uint8_t* m_strip;
+        static int index_of(char ch) {
+            for(size_t i = 0;i<characters_size;++i) {
+                if(characters()[i]==ch) {
+                    return (int)i;
+                }
+            }
+            return -1;
+        }
+        static gfx::text_info char_info(const gfx::font& font, const char* ch) {
+            gfx::text_info ti;
+            ti.text = ch;
+            ti.text_byte_count = 1;
+            ti.text_font = &font;
+            ti.encoding = &gfx::text_encoding::utf8;
+            return ti;
+        }
+        void free_strip() {
+            if(m_strip!=nullptr) {
+                m_deallocator(m_strip);
+                m_strip = nullptr;
+            }
+        }
+        // the widest character in the set, so every cell is the same width
+        void measure_cells() {
+            m_cell_width = 0;
+            if(m_font==nullptr) {
+                return;
+            }
+            for(size_t i = 0;i<characters_size;++i) {
+                size16 sz;
+                m_font->measure(uint16_t(-1),char_info(*m_font,characters()+i),&sz);
+                if(sz.width>m_cell_width) {
+                    m_cell_width = sz.width;
+                }
+            }
+        }
+        size16 strip_dimensions() const {
+            return size16(m_cell_width*characters_size,m_font->line_height());
+        }
+        void build_strip() {
+            if(m_strip!=nullptr || m_font==nullptr || m_cell_width==0 || m_background_color.template channel<gfx::channel_name::A>()!=255) {
+                return;
+            }
+            const size16 dim = strip_dimensions();
+            m_strip = (uint8_t*)m_allocator(bitmap_type::sizeof_buffer(dim));
+            if(m_strip==nullptr) {
+                return;
+            }
+            bitmap_type bmp(dim,m_strip,this->palette());
+            gfx::draw::filled_rectangle(bmp,bmp.bounds(),m_background_color);
+            for(size_t i = 0;i<characters_size;++i) {
+                gfx::draw::text(bmp,cell_text_rect(i*m_cell_width,0,characters()+i),char_info(*m_font,characters()+i),m_color);
+            }
+        }
+        // centers a character horizontally in a cell at x, y
+        srect16 cell_text_rect(int16_t x, int16_t y, const char* ch) const {
+            size16 sz;
+            m_font->measure(uint16_t(-1),char_info(*m_font,ch),&sz);
+            const int16_t x1 = x+(m_cell_width-sz.width)/2;
+            return srect16(x1,y,x1+sz.width-1,y+m_font->line_height()-1);
+        }
+        // the bounds of a cell in control coordinates
+        srect16 cell_bounds(size_t index) const {
+            const ssize16 dim = this->dimensions();
+            const int16_t x1 = dim.width-(int16_t)((m_cell_count-index)*m_cell_width);
+            const int16_t y1 = (dim.height-m_font->line_height())/2;
+            return srect16(x1,y1,x1+m_cell_width-1,y1+m_font->line_height()-1);
+        }
+        void reset_cells() {
+            for(size_t i = 0;i<max_length;++i) {
+                m_cells[i]=' ';
+            }
+        }
+    protected:
+        void do_move_control(numeric_label& rhs) {
+            this->base_type::do_move_control(rhs);
+            free_strip();
+            m_font = rhs.m_font;
+            m_color = rhs.m_color;
+            m_background_color = rhs.m_background_color;
+            memcpy(m_cells,rhs.m_cells,sizeof(m_cells));
+            m_cell_count = rhs.m_cell_count;
+            m_cell_width = rhs.m_cell_width;
+            m_allocator = rhs.m_allocator;
+            m_deallocator = rhs.m_deallocator;
+            m_strip = rhs.m_strip;
+            rhs.m_strip = nullptr;
+        }
+        void do_copy_control(const numeric_label& rhs) {
+            this->base_type::do_copy_control(rhs);
+            free_strip();
+            m_font = rhs.m_font;
+            m_color = rhs.m_color;
+            m_background_color = rhs.m_background_color;
+            memcpy(m_cells,rhs.m_cells,sizeof(m_cells));
+            m_cell_count = rhs.m_cell_count;
+            m_cell_width = rhs.m_cell_width;
+            m_allocator = rhs.m_allocator;
+            m_deallocator = rhs.m_deallocator;
+        }
+    public:
+        /// @brief Moves a numeric_label
+        /// @param rhs The numeric_label to move
+        numeric_label(numeric_label&& rhs) : m_strip(nullptr) {
+            do_move_control(rhs);
+        }
+        /// @brief Moves a numeric_label
+        /// @param rhs The numeric_label to move
+        /// @return this
+        numeric_label& operator=(numeric_label&& rhs) {
+            do_move_control(rhs);
+            return *this;
+        }
+        /// @brief Copies a numeric_label
+        /// @param rhs The numeric_label to copy
+        numeric_label(const numeric_label& rhs) : m_strip(nullptr) {
+            do_copy_control(rhs);
+        }
+        /// @brief Copies a numeric_label
+        /// @param rhs The numeric_label to copy
+        /// @return this
+        numeric_label& operator=(const numeric_label& rhs) {
+            do_copy_control(rhs);
+            return *this;
+        }
+        /// @brief Constructs a new instance of a numeric_label with the specified parent and optional palette
+        /// @param parent The parent. Usually this is the screen
+        /// @param palette The palette, if any. This is usually taken from the screen
+        /// @param allocator The allocator for the character strip
+        /// @param deallocator The deallocator for the character strip
+        numeric_label(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(parent,palette), m_font(nullptr), m_color(0xFF,0xFF,0xFF,0xFF), m_background_color(0,0,0,0xFF), m_cell_count(8), m_cell_width(0), m_allocator(allocator), m_deallocator(deallocator), m_strip(nullptr) {
+            reset_cells();
+        }
+        /// @brief Constructs a new instance of a numeric_label
+        /// @param allocator The allocator for the character strip
+        /// @param deallocator The deallocator for the character strip
+        numeric_label(void*(allocator)(size_t) = ::malloc,void(deallocator)(void*) = ::free) : base_type(), m_font(nullptr), m_color(0xFF,0xFF,0xFF,0xFF), m_background_color(0,0,0,0xFF), m_cell_count(8), m_cell_width(0), m_allocator(allocator), m_deallocator(deallocator), m_strip(nullptr) {
+            reset_cells();
+        }
+        /// @brief Destroys the numeric_label, freeing the character strip
+        virtual ~numeric_label() {
+            free_strip();
+        }
+        /// @brief Indicates the font being used, if any
+        /// @return A pointer to the font
+        const gfx::font* font() const {
+            return m_font;
+        }
+        /// @brief Sets the font
+        /// @param value The font
+        void font(const gfx::font& value) {
+            m_font = &value;
+            free_strip();
+            measure_cells();
+            this->invalidate();
+        }
+        /// @brief Indicates the text color
+        /// @return The RGBA8888 color
+        gfx::rgba_pixel<32> color() const {
+            return m_color;
+        }
+        /// @brief Sets the text color
+        /// @param value The RGBA8888 color
+        void color(gfx::rgba_pixel<32> value) {
+            m_color = value;
+            free_strip();
+            this->invalidate();
+        }
+        /// @brief Indicates the background color
+        /// @return The RGBA8888 color
+        gfx::rgba_pixel<32> background_color() const {
+            return m_background_color;
+        }
+        /// @brief Sets the background color. If it is not opaque, each changed character is drawn as text over the controls beneath instead of copied from the strip
+        /// @param value The RGBA8888 color
+        void background_color(gfx::rgba_pixel<32> value) {
+            m_background_color = value;
+            free_strip();
+            this->invalidate();
+        }
+        /// @brief Indicates the number of character cells
+        /// @return The number of cells
+        size_t cell_count() const {
+            return m_cell_count;
+        }
+        /// @brief Sets the number of character cells. Values are right justified in them.
+        /// @param value The number of cells, up to max_length
+        void cell_count(size_t value) {
+            if(value>max_length) {
+                value = max_length;
+            }
+            m_cell_count = value;
+            reset_cells();
+            this->invalidate();
+        }
+        /// @brief Sets the text, invalidating only the cells that change
+        /// @param value The text, made of digits, spaces and + - . , : %
+        /// @return The result of the operation
+        uix_result text(const char* value) {
+            if(value==nullptr) {
+                return uix_result::invalid_argument;
+            }
+            const size_t len = strlen(value);
+            if(len>m_cell_count) {
+                return uix_result::invalid_argument;
+            }
+            for(size_t i = 0;i<len;++i) {
+                if(index_of(value[i])<0) {
+                    return uix_result::invalid_argument;
+                }
+            }
+            const size_t start = m_cell_count-len;
+            for(size_t i = 0;i<m_cell_count;++i) {
+                const char ch = i<start?' ':value[i-start];
+                if(m_cells[i]!=ch) {
+                    m_cells[i] = ch;
+                    if(m_font!=nullptr) {
+                        this->invalidate(cell_bounds(i));
+                    }
+                }
+            }
+            return uix_result::success;
+        }
+        /// @brief Sets the value to an integer, invalidating only the cells that change
+        /// @param value The value
+        /// @return The result of the operation
+        uix_result value(long value) {
+            char sz[max_length+1];
+            if(snprintf(sz,sizeof(sz),"%ld",value)>=(int)sizeof(sz)) {
+                return uix_result::invalid_argument;
+            }
+            return text(sz);
+        }
+        /// @brief Sets the value to a fixed point number, invalidating only the cells that change
+        /// @param value The value
+        /// @param decimals The number of digits after the decimal point
+        /// @return The result of the operation
+        uix_result value(double value, uint8_t decimals) {
+            char sz[max_length+1];
+            if(snprintf(sz,sizeof(sz),"%.*f",(int)decimals,value)>=(int)sizeof(sz)) {
+                return uix_result::invalid_argument;
+            }
+            return text(sz);
+        }
+        /// @brief Called once before the control is first rendered during update()
+        virtual void on_before_paint() override {
+            build_strip();
+        }
+        /// @brief Draws the cells inside the clip
+        /// @param destination The control surface to draw to
+        /// @param clip The clipping rectangle
+        virtual void on_paint(control_surface_type& destination,const srect16& clip) override {
+            if(m_font==nullptr || m_cell_width==0 || m_cell_count==0) {
+                return;
+            }
+            const srect16 first = cell_bounds(0);
+            const srect16 cells(first.x1,first.y1,first.x1+(int16_t)(m_cell_count*m_cell_width)-1,first.y2);
+            if(m_background_color.opacity()!=0 && (m_strip==nullptr || !cells.contains(clip))) {
+                gfx::draw::filled_rectangle(destination,clip,m_background_color);
+            }
+            for(size_t i = 0;i<m_cell_count;++i) {
+                const srect16 cb = cell_bounds(i);
+                if(!cb.intersects(clip)) {
+                    continue;
+                }
+                const int idx = index_of(m_cells[i]);
+                if(m_strip!=nullptr) {
+                    // copy only the part of the cell inside the clip
+                    const bitmap_type strip(strip_dimensions(),m_strip,this->palette());
+                    const srect16 dr = cb.crop(clip);
+                    const int16_t x = idx*m_cell_width+(dr.x1-cb.x1);
+                    const int16_t y = dr.y1-cb.y1;
+                    gfx::draw::bitmap(destination,dr,strip,rect16(x,y,x+dr.width()-1,y+dr.height()-1));
+                } else if(m_cells[i]!=' ') {
+                    gfx::draw::text(destination,cell_text_rect(cb.x1,cb.y1,m_cells+i),char_info(*m_font,m_cells+i),m_color,&clip);
+                }
+            }
+        }
+    };
+}
+#endif
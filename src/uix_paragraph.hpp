@@ -0,0 +1,418 @@
+#ifndef HTCW_UIX_PARAGRAPH_HPP
+#define HTCW_UIX_PARAGRAPH_HPP
+#include <htcw_data.hpp>
+#include "uix_core.hpp"
+#include "uix_glyph_atlas.hpp"
+namespace uix {
+    /// @brief Represents a block of UTF-8 text that wraps at word boundaries to the width of the control.
+    /// The line breaks are computed once for the text, width and font, and kept across paints. Text can be appended,
+    /// such as for a log view, in which case only the last line and the new lines are laid out and redrawn.
+    /// @tparam ControlSurfaceType The control surface type, usually from the screen
+    template<typename ControlSurfaceType>
+    class paragraph final : public control<ControlSurfaceType> {
+    public:
+        using type = paragraph;
+        using base_type = control<ControlSurfaceType>;
+        using pixel_type = typename ControlSurfaceType::pixel_type;
+        using palette_type = typename ControlSurfaceType::palette_type;
+        using control_surface_type = ControlSurfaceType;
+    private:
+        struct line {
+            size_t offset;
+            size_t byte_count;
+        };
+        using lines_type = data::simple_vector<line>;
+        const gfx::font* m_font;
+        gfx::rgba_pixel<32> m_color;
+        gfx::rgba_pixel<32> m_background_color;
+        ssize16 m_padding;
+        uint16_t m_tab_width;
+        char* m_text;
+        size_t m_text_size;
+        size_t m_text_capacity;
+        lines_type m_lines;
+        int16_t m_layout_width;
+        uint8_t m_advances[95];
+        void* (*m_reallocator)(void*,size_t);
+        void (*m_deallocator)(void*);
+        void free_text() {
+            if(m_text!=nullptr) {
+                m_deallocator(m_text);
+                m_text = nullptr;
+            }
+            m_text_size = 0;
+            m_text_capacity = 0;
+        }
+        bool reserve(size_t size) {
+            if(size<=m_text_capacity) {
+                return true;
+            }
+            size_t capacity = m_text_capacity==0?64:m_text_capacity;
+            while(capacity<size) {
+                capacity*=2;
+            }
+            char* text = (char*)m_reallocator(m_text,capacity);
+            if(text==nullptr) {
+                return false;
+            }
+            m_text = text;
+            m_text_capacity = capacity;
+            return true;
+        }
+        gfx::text_info info(size_t offset, size_t byte_count) const {
+            gfx::text_info ti;
+            ti.text = m_text+offset;
+            ti.text_byte_count = byte_count;
+            ti.text_font = m_font;
+            ti.encoding = &gfx::text_encoding::utf8;
+            ti.tab_width = m_tab_width;
+            return ti;
+        }
+        // measures the printable ASCII characters once, so wrapping doesn't call measure per character
+        void measure_advances() {
+            if(m_font==nullptr) {
+                return;
+            }
+            for(size_t i = 0;i<sizeof(m_advances);++i) {
+                const char ch = (char)(i+0x20);
+                gfx::text_info ti;
+                ti.text = &ch;
+                ti.text_byte_count = 1;
+                ti.text_font = m_font;
+                ti.encoding = &gfx::text_encoding::utf8;
+                size16 sz;
+                m_font->measure(uint16_t(-1),ti,&sz);
+                m_advances[i] = sz.width>255?255:(uint8_t)sz.width;
+            }
+        }
+        // the width of the character at offset, and the number of bytes it takes
+        int16_t advance(size_t offset, size_t* out_byte_count) const {
+            const uint8_t c = (uint8_t)m_text[offset];
+            if(c>=0x20 && c<0x7F) {
+                *out_byte_count = 1;
+                return m_advances[c-0x20];
+            }
+            size_t n = c>=0xF0?4:c>=0xE0?3:c>=0xC0?2:1;
+            if(offset+n>m_text_size) {
+                n = m_text_size-offset;
+            }
+            *out_byte_count = n;
+            if(c<0x80) {
+                // other control characters
+                return 0;
+            }
+            size16 sz;
+            m_font->measure(uint16_t(-1),info(offset,n),&sz);
+            return sz.width;
+        }
+        int16_t text_width() const {
+            return this->dimensions().width-m_padding.width*2;
+        }
+        int16_t line_height() const {
+            return m_font->line_height();
+        }
+        // breaks the text into lines starting with the given line, which is laid out again along with everything after it
+        void layout(size_t first_line) {
+            size_t pos = 0;
+            if(first_line<m_lines.size()) {
+                pos = m_lines.begin()[first_line].offset;
+                m_lines.erase(m_lines.begin()+first_line,m_lines.end()-1);
+            } else if(m_lines.size()!=0) {
+                // nothing to redo
+                pos = m_text_size;
+            }
+            const int16_t max_width = text_width();
+            while(pos<m_text_size) {
+                const size_t start = pos;
+                size_t space = (size_t)-1;
+                int16_t width = 0;
+                size_t i = pos;
+                while(true) {
+                    if(i==m_text_size) {
+                        m_lines.push_back({start,i-start});
+                        pos = i;
+                        break;
+                    }
+                    const char c = m_text[i];
+                    if(c=='\n') {
+                        m_lines.push_back({start,i-start});
+                        pos = i+1;
+                        if(pos==m_text_size) {
+                            // the empty line after a trailing break
+                            m_lines.push_back({pos,0});
+                        }
+                        break;
+                    }
+                    size_t n;
+                    int16_t adv;
+                    if(c=='\t') {
+                        // where a tab lands depends on where it starts, so measure through it the way it is drawn
+                        size16 sz;
+                        m_font->measure(uint16_t(-1),info(start,i+1-start),&sz);
+                        adv = sz.width-width;
+                        n = 1;
+                    } else {
+                        adv = advance(i,&n);
+                    }
+                    if(c==' ') {
+                        space = i;
+                    }
+                    if(width+adv>max_width && i>start) {
+                        if(space!=(size_t)-1) {
+                            // break after the last word that fits, dropping the space
+                            m_lines.push_back({start,space-start});
+                            pos = space+1;
+                        } else {
+                            // a word wider than the line breaks anywhere
+                            m_lines.push_back({start,i-start});
+                            pos = i;
+                        }
+                        break;
+                    }
+                    width+=adv;
+                    i+=n;
+                }
+            }
+            m_layout_width = max_width;
+        }
+        bool layout_valid() const {
+            return m_font!=nullptr && m_layout_width==text_width();
+        }
+        void invalidate_layout() {
+            m_layout_width = -1;
+            m_lines.clear();
+        }
+    protected:
+        void do_move_control(paragraph& rhs) {
+            this->base_type::do_move_control(rhs);
+            free_text();
+            m_font = rhs.m_font;
+            m_color = rhs.m_color;
+            m_background_color = rhs.m_background_color;
+            m_padding = rhs.m_padding;
+            m_tab_width = rhs.m_tab_width;
+            m_text = rhs.m_text;
+            m_text_size = rhs.m_text_size;
+            m_text_capacity = rhs.m_text_capacity;
+            rhs.m_text = nullptr;
+            rhs.m_text_size = 0;
+            rhs.m_text_capacity = 0;
+            m_lines = helpers::uix_move(rhs.m_lines);
+            m_layout_width = rhs.m_layout_width;
+            rhs.m_layout_width = -1;
+            memcpy(m_advances,rhs.m_advances,sizeof(m_advances));
+            m_reallocator = rhs.m_reallocator;
+            m_deallocator = rhs.m_deallocator;
+        }
+        void do_copy_control(const paragraph& rhs) {
+            this->base_type::do_copy_control(rhs);
+            free_text();
+            m_font = rhs.m_font;
+            m_color = rhs.m_color;
+            m_background_color = rhs.m_background_color;
+            m_padding = rhs.m_padding;
+            m_tab_width = rhs.m_tab_width;
+            m_reallocator = rhs.m_reallocator;
+            m_deallocator = rhs.m_deallocator;
+            memcpy(m_advances,rhs.m_advances,sizeof(m_advances));
+            invalidate_layout();
+            if(rhs.m_text_size!=0 && reserve(rhs.m_text_size)) {
+                memcpy(m_text,rhs.m_text,rhs.m_text_size);
+                m_text_size = rhs.m_text_size;
+            }
+        }
+    public:
+        /// @brief Moves a paragraph
+        /// @param rhs The paragraph to move
+        paragraph(paragraph&& rhs) : m_text(nullptr), m_lines(::malloc,rhs.m_reallocator,rhs.m_deallocator) {
+            do_move_control(rhs);
+        }
+        /// @brief Moves a paragraph
+        /// @param rhs The paragraph to move
+        /// @return this
+        paragraph& operator=(paragraph&& rhs) {
+            do_move_control(rhs);
+            return *this;
+        }
+        /// @brief Copies a paragraph
+        /// @param rhs The paragraph to copy
+        paragraph(const paragraph& rhs) : m_text(nullptr), m_lines(::malloc,rhs.m_reallocator,rhs.m_deallocator) {
+            do_copy_control(rhs);
+        }
+        /// @brief Copies a paragraph
+        /// @param rhs The paragraph to copy
+        /// @return this
+        paragraph& operator=(const paragraph& rhs) {
+            do_copy_control(rhs);
+            return *this;
+        }
+        /// @brief Constructs a new instance of a paragraph with the specified parent and optional palette
+        /// @param parent The parent. Usually this is the screen
+        /// @param palette The palette, if any. This is usually taken from the screen
+        /// @param reallocator The reallocator for the text and line breaks
+        /// @param deallocator The deallocator for the text and line breaks
+        paragraph(invalidation_tracker& parent, const palette_type* palette = nullptr,void*(reallocator)(void*,size_t) = ::realloc,void(deallocator)(void*) = ::free) : base_type(parent,palette), m_font(nullptr), m_color(0xFF,0xFF,0xFF,0xFF), m_background_color(0,0,0,0), m_padding(4,4), m_tab_width(gfx::text_info().tab_width), m_text(nullptr), m_text_size(0), m_text_capacity(0), m_lines(::malloc,reallocator,deallocator), m_layout_width(-1), m_reallocator(reallocator), m_deallocator(deallocator) {
+        }
+        /// @brief Constructs a new instance of a paragraph
+        /// @param reallocator The reallocator for the text and line breaks
+        /// @param deallocator The deallocator for the text and line breaks
+        paragraph(void*(reallocator)(void*,size_t) = ::realloc,void(deallocator)(void*) = ::free) : base_type(), m_font(nullptr), m_color(0xFF,0xFF,0xFF,0xFF), m_background_color(0,0,0,0), m_padding(4,4), m_tab_width(gfx::text_info().tab_width), m_text(nullptr), m_text_size(0), m_text_capacity(0), m_lines(::malloc,reallocator,deallocator), m_layout_width(-1), m_reallocator(reallocator), m_deallocator(deallocator) {
+        }
+        /// @brief Destroys the paragraph, freeing the text
+        virtual ~paragraph() {
+            free_text();
+        }
+        /// @brief Indicates the text
+        /// @return The text, which is not null terminated, or null if there is none
+        const char* text() const {
+            return m_text;
+        }
+        /// @brief Indicates the size of the text
+        /// @return The number of bytes of text
+        size_t text_byte_count() const {
+            return m_text_size;
+        }
+        /// @brief Sets the text, which is copied
+        /// @param value The UTF-8 text, which may contain line breaks
+        /// @return The result of the operation
+        uix_result text(const char* value) {
+            m_text_size = 0;
+            invalidate_layout();
+            this->invalidate();
+            return append(value);
+        }
+        /// @brief Adds text to the end, laying out and redrawing only the last line and the lines that follow it
+        /// @param value The UTF-8 text, which may contain line breaks
+        /// @return The result of the operation
+        uix_result append(const char* value) {
+            if(value==nullptr) {
+                return uix_result::invalid_argument;
+            }
+            const size_t len = strlen(value);
+            if(len==0) {
+                return uix_result::success;
+            }
+            if(!reserve(m_text_size+len)) {
+                return uix_result::out_of_memory;
+            }
+            memcpy(m_text+m_text_size,value,len);
+            m_text_size+=len;
+            if(!layout_valid()) {
+                invalidate_layout();
+                this->invalidate();
+                return uix_result::success;
+            }
+            const size_t first = m_lines.size()==0?0:m_lines.size()-1;
+            layout(first);
+            const int16_t lh = line_height();
+            return this->invalidate(srect16(0,m_padding.height+(int16_t)(first*lh),this->dimensions().width-1,m_padding.height+(int16_t)(m_lines.size()*lh)-1));
+        }
+        /// @brief Removes all the text
+        void clear() {
+            free_text();
+            invalidate_layout();
+            this->invalidate();
+        }
+        /// @brief Indicates the number of lines the text wraps to, as of the last layout
+        /// @return The number of lines
+        size_t lines_size() const {
+            return m_lines.size();
+        }
+        /// @brief Indicates the font being used, if any
+        /// @return A pointer to the font
+        const gfx::font* font() const {
+            return m_font;
+        }
+        /// @brief Sets the font
+        /// @param value The font
+        void font(const gfx::font& value) {
+            m_font = &value;
+            measure_advances();
+            invalidate_layout();
+            this->invalidate();
+        }
+        /// @brief Indicates the text color
+        /// @return The RGBA8888 color
+        gfx::rgba_pixel<32> color() const {
+            return m_color;
+        }
+        /// @brief Sets the text color
+        /// @param value The RGBA8888 color
+        void color(gfx::rgba_pixel<32> value) {
+            m_color = value;
+            this->invalidate();
+        }
+        /// @brief Indicates the background color
+        /// @return The RGBA8888 color
+        gfx::rgba_pixel<32> background_color() const {
+            return m_background_color;
+        }
+        /// @brief Sets the background color
+        /// @param value The RGBA8888 color
+        void background_color(gfx::rgba_pixel<32> value) {
+            m_background_color = value;
+            this->invalidate();
+        }
+        /// @brief Indicates the padding around the text
+        /// @return A ssize16 indicating the padding
+        ssize16 padding() const {
+            return m_padding;
+        }
+        /// @brief Sets the padding around the text
+        /// @param value a ssize16 indicating the padding
+        void padding(ssize16 value) {
+            m_padding = value;
+            invalidate_layout();
+            this->invalidate();
+        }
+        /// @brief Indicates the tab width
+        /// @return The tab width used for this font
+        uint16_t tab_width() const {
+            return m_tab_width;
+        }
+        /// @brief Sets the tab width
+        /// @param value The tab width for this font
+        void tab_width(uint16_t value) {
+            m_tab_width = value;
+            invalidate_layout();
+            this->invalidate();
+        }
+        /// @brief Draws the lines inside the clip
+        /// @param destination The control surface to draw to
+        /// @param clip The clipping rectangle
+        virtual void on_paint(control_surface_type& destination,const srect16& clip) override {
+            if(m_background_color.opacity()!=0) {
+                gfx::draw::filled_rectangle(destination,clip,m_background_color);
+            }
+            if(m_font==nullptr || m_text_size==0 || text_width()<=0) {
+                return;
+            }
+            if(!layout_valid()) {
+                invalidate_layout();
+                layout(0);
+            }
+            const int16_t lh = line_height();
+            const int16_t top = clip.y1-m_padding.height;
+            size_t i = top<0?0:top/lh;
+            gfx::text_info ti = info(0,0);
+            glyph_atlas* atlas = this->text_glyph_atlas();
+            if(atlas!=nullptr) {
+                atlas->acquire(*m_font,&ti.draw_cache,&ti.measure_cache);
+            }
+            for(;i<m_lines.size();++i) {
+                const line& l = m_lines.begin()[i];
+                const int16_t y = m_padding.height+(int16_t)(i*lh);
+                if(y>clip.y2) {
+                    break;
+                }
+                if(l.byte_count==0) {
+                    continue;
+                }
+                ti.text = m_text+l.offset;
+                ti.text_byte_count = l.byte_count;
+                gfx::draw::text(destination,srect16(m_padding.width,y,this->dimensions().width-m_padding.width-1,y+lh-1),ti,m_color,&clip);
+            }
+        }
+    };
+}
+#endif
@@ -792,6 +792,8 @@ namespace uix {
         qr_t::code m_code;
         gfx::rgba_pixel<32> m_color;
         gfx::rgba_pixel<32> m_background_color;
+        typename base_type::native_color_type m_native_color;
+        typename base_type::native_color_type m_native_background_color;
         void recompute() {
             if(m_buffer!=nullptr) {
                 m_deallocator(m_buffer);
@@ -949,8 +951,7 @@ namespace uix {
                 return;
             }
             pixel_type p;
-            if(m_background_color.opacity()>0.f) {
-                gfx::convert(m_background_color,&p);
+            if(m_background_color.opacity()>0.f && gfx::gfx_result::success==m_native_background_color.get(destination,m_background_color,&p)) {
                 destination.fill(destination.bounds(),p);
             }
             const uint16_t w = destination.dimensions().height<destination.dimensions().width?destination.dimensions().height:destination.dimensions().width;
@@ -960,7 +961,9 @@ namespace uix {
             } else {
                 s.width=s.height=w/m_code.size;
             }
-            gfx::convert(m_color,&p);
+            if(gfx::gfx_result::success!=m_native_color.get(destination,m_color,&p)) {
+                return;
+            }
             int offsx = (destination.dimensions().width-(m_code.size*s.width))/2;
             int offsy = (destination.dimensions().height-(m_code.size*s.height))/2;
             int xx =0,yy=0;
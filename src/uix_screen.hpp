@@ -1,8 +1,10 @@
 #ifndef HTCW_UIX_SCREEN_HPP
 #define HTCW_UIX_SCREEN_HPP
+#include <chrono>
 #include <htcw_data.hpp>
 
 #include "uix_core.hpp"
+#include "uix_glyph_atlas.hpp"
 namespace uix {
 enum struct screen_update_mode {
     // update parts pf the display using backbuffering
@@ -30,6 +32,10 @@ class screen_base : public invalidation_tracker {
     typedef void (*on_touch_callback_type)(point16* out_locations,
                                            size_t* in_out_locations_size,
                                            void* state);
+    /// @brief The vsync callback for getting the panel's scan timing, usually
+    /// from a tearing effect (TE) pin interrupt
+    typedef void (*on_vsync_callback_type)(uint32_t* out_vsync_timestamp,
+                                           uint32_t* out_now, void* state);
 
     /// @brief Invalidate a rectangular region
     /// @param rect The region to invalidate
@@ -65,6 +71,14 @@ class screen_base : public invalidation_tracker {
     /// @brief The strategy used to update the screen, either favoring minimum redraws, minimum transfers, or balanced
     /// @param value The screen update strategy
     virtual void update_strategy(screen_update_strategy value) = 0;
+    /// @brief Indicates the height of the interlace bands in partial mode
+    /// @return The band height in lines, or 0 if interlacing is off
+    virtual uint16_t interlace_lines() const = 0;
+    /// @brief Sets the height of the interlace bands in partial mode. Where
+    /// interlaced controls are being updated, alternating bands are sent on
+    /// alternating frames.
+    /// @param value The band height in lines, or 0 to turn interlacing off
+    virtual void interlace_lines(uint16_t value) = 0;
     /// @brief Indicates the size of the transfer buffer(s)
     /// @return a size_t containing the size of the buffer
     virtual size_t buffer_size() const = 0;
@@ -126,6 +140,48 @@ class screen_base : public invalidation_tracker {
     /// @param state A user defined state value to pass to the callback
     virtual void on_touch_callback(on_touch_callback_type callback,
                                    void* state = nullptr) = 0;
+    /// @brief Retrieves the vsync callback
+    /// @return A pointer to the callback method
+    virtual on_vsync_callback_type on_vsync_callback() const = 0;
+    /// @brief Retrieves the vsync callback state
+    /// @return The user defined vsync callback state
+    virtual void* on_vsync_callback_state() const = 0;
+    /// @brief Sets the vsync callback. When set along with a line period, tiles
+    /// are scheduled and flushed so they stay behind the panel's scan line.
+    /// This is experimental, and has no effect unless UIX_EXPERIMENTAL_VSYNC
+    /// is defined.
+    /// @param callback The callback that reports the time of the last vsync
+    /// (TE) pulse and the current time, in the same units
+    /// @param state A user defined state value to pass to the callback
+    virtual void on_vsync_callback(on_vsync_callback_type callback,
+                                   void* state = nullptr) = 0;
+    /// @brief Indicates the time the panel takes to scan one line
+    /// @return The line period, in the units reported by the vsync callback
+    virtual uint32_t vsync_line_period() const = 0;
+    /// @brief Sets the time the panel takes to scan one line
+    /// @param value The line period, in the units reported by the vsync
+    /// callback
+    virtual void vsync_line_period(uint32_t value) = 0;
+    /// @brief Indicates the number of lines in one panel refresh, including
+    /// blanking
+    /// @return The line count, or 0 to use the screen height
+    virtual uint32_t vsync_line_count() const = 0;
+    /// @brief Sets the number of lines in one panel refresh, including
+    /// blanking
+    /// @param value The line count, or 0 to use the screen height
+    virtual void vsync_line_count(uint32_t value) = 0;
+    /// @brief Indicates the cache controls keep decoded images in across frames
+    /// @return The image cache, or null if there is none
+    virtual image_cache* decoded_image_cache() const override = 0;
+    /// @brief Sets the cache controls keep decoded images in across frames
+    /// @param value The image cache, or null to decode images every frame
+    virtual void decoded_image_cache(image_cache* value) = 0;
+    /// @brief Indicates the atlas text controls share rasterized glyphs through
+    /// @return The glyph atlas, or null if there is none
+    virtual glyph_atlas* text_glyph_atlas() const override = 0;
+    /// @brief Sets the atlas text controls share rasterized glyphs through
+    /// @param value The glyph atlas, or null to have each control use its own caches
+    virtual void text_glyph_atlas(glyph_atlas* value) = 0;
     /// @brief Updates the screen, processing touch input and updating and
     /// flushing invalid portions of the screen to the display
     /// @param full True to fully update the display, false to only update one
@@ -136,14 +192,25 @@ class screen_base : public invalidation_tracker {
     /// @return True if the screen needs updating, otherwise false
     virtual bool dirty() const = 0;
     virtual bool flush_pending() const = 0;
+    /// @brief Begins a batch. Until the matching end_batch(), invalidated
+    /// regions are held and merged into the dirty set all at once. Batches
+    /// may be nested.
+    virtual void begin_batch() = 0;
+    /// @brief Ends a batch begun with begin_batch(). When the outermost batch
+    /// ends, the regions invalidated during it are merged into the dirty set.
+    /// @return The result of the operation
+    virtual uix_result end_batch() = 0;
 };
 /// @brief Represents a screen
 /// @tparam BitmapType The type of backing bitmap used over the transfer buffer.
 /// This is what is drawn to by the controls.
 /// @tparam HorizontalAlignment The update rectangle alignment on the x-axis
 /// @tparam VerticalAlignment The update rectangle alignment on the y-axis
+/// @tparam DirtyCellSize When non-zero, damage is tracked in a bitmap of cells
+/// this size (rounded up to the alignment) rather than a list of merged
+/// rectangles. Suits screens with many small controls changing every frame.
 template <typename BitmapType, uint8_t HorizontalAlignment = 1,
-          uint8_t VerticalAlignment = 1>
+          uint8_t VerticalAlignment = 1, uint16_t DirtyCellSize = 0>
 class screen_ex final : public screen_base {
    public:
     using type = screen_ex;
@@ -166,6 +233,16 @@ class screen_ex final : public screen_base {
     constexpr static const uint8_t horizontal_alignment = HorizontalAlignment;
     /// @brief The update rectangle alignment on the y-axis
     constexpr static const uint8_t vertical_alignment = VerticalAlignment;
+    /// @brief The width of a dirty cell, or 0 if dirty rectangles are tracked
+    /// as a list
+    constexpr static const uint16_t dirty_cell_width =
+        (uint16_t)((DirtyCellSize + HorizontalAlignment - 1) /
+                   HorizontalAlignment * HorizontalAlignment);
+    /// @brief The height of a dirty cell, or 0 if dirty rectangles are tracked
+    /// as a list
+    constexpr static const uint16_t dirty_cell_height =
+        (uint16_t)((DirtyCellSize + VerticalAlignment - 1) /
+                   VerticalAlignment * VerticalAlignment);
 
    private:
     struct tracker_entry {
@@ -176,6 +253,7 @@ class screen_ex final : public screen_base {
         int state;
     };
     using dirty_rects_type = data::simple_vector<rect16>;
+    using dirty_cells_type = data::simple_vector<uint32_t>;
     using controls_type = data::simple_vector<tracker_entry>;
 
     screen_ex(const screen_ex& rhs) = delete;
@@ -217,6 +295,43 @@ class screen_ex final : public screen_base {
         m_flush_pending = rhs.m_flush_pending;
         m_flush_pending_bounds = rhs.m_flush_pending_bounds;
         m_update_mode = rhs.m_update_mode;
+        m_split = rhs.m_split;
+        m_split_size = rhs.m_split_size;
+        m_split_votes = rhs.m_split_votes;
+        m_frame_start = rhs.m_frame_start;
+        m_paint_us = rhs.m_paint_us;
+        m_flush_call_us = rhs.m_flush_call_us;
+        m_frame_bytes = rhs.m_frame_bytes;
+        m_last_tile_bytes = rhs.m_last_tile_bytes;
+        m_frame_timed = rhs.m_frame_timed;
+        m_paint_cost = rhs.m_paint_cost;
+        m_stall_cost = rhs.m_stall_cost;
+        m_on_vsync_callback = rhs.m_on_vsync_callback;
+        rhs.m_on_vsync_callback = nullptr;
+        m_on_vsync_callback_state = rhs.m_on_vsync_callback_state;
+        m_vsync_line_period = rhs.m_vsync_line_period;
+        m_vsync_line_count = rhs.m_vsync_line_count;
+        m_vsync_frame = rhs.m_vsync_frame;
+        m_tiles = helpers::uix_move(rhs.m_tiles);
+        m_vsync_write_cost = rhs.m_vsync_write_cost;
+        m_vsync_flush_start = rhs.m_vsync_flush_start;
+        m_vsync_flush_bytes = rhs.m_vsync_flush_bytes;
+        m_next_dirty = helpers::uix_move(rhs.m_next_dirty);
+        m_merge_next_frame = rhs.m_merge_next_frame;
+        m_cells = helpers::uix_move(rhs.m_cells);
+        m_cells_across = rhs.m_cells_across;
+        m_cells_down = rhs.m_cells_down;
+        m_cells_dirty = rhs.m_cells_dirty;
+        m_decoded_image_cache = rhs.m_decoded_image_cache;
+        m_text_glyph_atlas = rhs.m_text_glyph_atlas;
+        m_controls_invalid = rhs.m_controls_invalid;
+        m_batch = helpers::uix_move(rhs.m_batch);
+        m_batch_depth = rhs.m_batch_depth;
+        m_interlace_lines = rhs.m_interlace_lines;
+        m_il_phase = rhs.m_il_phase;
+        m_il_active = rhs.m_il_active;
+        m_il_tile = rhs.m_il_tile;
+        m_il_y = rhs.m_il_y;
     }
 
     template <typename T>
@@ -252,10 +367,27 @@ class screen_ex final : public screen_base {
         }
         return rect16(h_align_down(value.x1), v_align_down(value.y1), x2, y2);
     }
+    // the buffer tiles ping-pong with: buffer2, or the back half of buffer1
+    // when it has been split
+    uint8_t* second_buffer() const {
+        return m_split ? m_buffer1 + m_split_size : m_buffer2;
+    }
+    // the bytes available to a single tile
+    size_t tile_buffer_size() const {
+        return m_split ? m_split_size : m_buffer_size;
+    }
+    void reset_split() {
+        m_split_votes = 0;
+        if (m_split) {
+            m_split = false;
+            m_write_buffer = m_buffer1;
+        }
+    }
     bool switch_buffers() {
-        if (m_buffer2 != nullptr) {
+        uint8_t* buffer2 = second_buffer();
+        if (buffer2 != nullptr) {
             if (m_buffer1 == m_write_buffer) {
-                m_write_buffer = m_buffer2;
+                m_write_buffer = buffer2;
             } else {
                 if (m_on_wait_flush_callback != nullptr) {
                     m_on_wait_flush_callback(m_on_wait_flush_callback_state);
@@ -280,17 +412,18 @@ class screen_ex final : public screen_base {
 
     bool fits_buffer(const rect16& r) const {
         return native_bitmap_type::sizeof_buffer(
-                   size16(r.width(), r.height())) <= m_buffer_size;
+                   size16(r.width(), r.height())) <= tile_buffer_size();
     }
     // max vertically-aligned line count of width w that fits one buffer
     uint16_t max_lines_for(uint16_t w) const {
         size_t stride = native_bitmap_type::sizeof_buffer(size16(w, 1));
         if (stride == 0) return 0;
-        int lines = v_align_down((int)(m_buffer_size / stride));
+        const size_t size = tile_buffer_size();
+        int lines = v_align_down((int)(size / stride));
         if (lines > dimensions().height) lines = dimensions().height;
         while (lines > 0 &&
                native_bitmap_type::sizeof_buffer(size16(w, (uint16_t)lines)) >
-                   m_buffer_size) {
+                   size) {
             lines -= 1;
         }
         return (uint16_t)lines;
@@ -517,7 +650,97 @@ class screen_ex final : public screen_base {
         }
     }
 
+    // beam scheduling is experimental, and only compiled in on request
+    bool vsync_enabled() const {
+#ifdef UIX_EXPERIMENTAL_VSYNC
+        return m_on_vsync_callback != nullptr && m_vsync_line_period != 0;
+#else
+        return false;
+#endif
+    }
+    uint32_t vsync_lines() const {
+        return m_vsync_line_count != 0 ? m_vsync_line_count
+                                       : (uint32_t)dimensions().height;
+    }
+    // the line the panel is currently scanning out, and the current time
+    uint32_t vsync_beam(uint32_t* out_now = nullptr) const {
+        uint32_t ts = 0, now = 0;
+        m_on_vsync_callback(&ts, &now, m_on_vsync_callback_state);
+        if (out_now != nullptr) *out_now = now;
+        return ((now - ts) / m_vsync_line_period) % vsync_lines();
+    }
+    // lines from the beam forward (wrapping) to the top of r
+    uint32_t vsync_lead(uint32_t beam, const rect16& r) const {
+        uint32_t lines = vsync_lines();
+        return ((uint32_t)r.y1 + lines - beam % lines) % lines;
+    }
+    // true if r can be written now without the beam passing through it
+    bool vsync_safe(uint32_t beam, const rect16& r) const {
+        uint32_t lines = vsync_lines();
+        if (r.height() >= lines) return true;  // nothing to be gained
+        if (beam >= r.y1 && beam <= r.y2) return false;
+        // lines the beam travels while r is transferred
+        size_t bytes = native_bitmap_type::sizeof_buffer(
+            size16(r.width(), r.height()));
+        uint32_t travel = (uint32_t)((((uint64_t)m_vsync_write_cost * bytes) >>
+                                      16) /
+                                     m_vsync_line_period) +
+                          1;
+        // too slow to ever fit ahead of the beam. The beam having just left it
+        // is the best we can do.
+        if (travel + r.height() >= lines) return true;
+        return vsync_lead(beam, r) > travel;
+    }
+    void vsync_flush_started(const rect16& r) {
+        if (!vsync_enabled()) return;
+        vsync_beam(&m_vsync_flush_start);
+        m_vsync_flush_bytes =
+            native_bitmap_type::sizeof_buffer(size16(r.width(), r.height()));
+    }
+    // called at the top of each update to time the last transfer, in vsync
+    // units per byte (16.16). Polled, so it errs long, which is the safe side.
+    void vsync_sample_flush() {
+        if (m_vsync_flush_bytes == 0 || m_flushing) return;
+        uint32_t now;
+        vsync_beam(&now);
+        uint32_t cost = (uint32_t)(((uint64_t)(now - m_vsync_flush_start)
+                                    << 16) /
+                                   m_vsync_flush_bytes);
+        m_vsync_write_cost = (m_vsync_write_cost == 0)
+                                 ? cost
+                                 : m_vsync_write_cost -
+                                       (m_vsync_write_cost >> 2) + (cost >> 2);
+        m_vsync_flush_bytes = 0;
+    }
+    // raster order: take the tile the beam passed most recently, since it has
+    // the longest until the beam comes back around to it
+    plan_status vsync_next(rect16& out) {
+        if (m_tiles.size() == 0) return plan_status::done;
+        uint32_t beam = vsync_beam();
+        rect16* best = nullptr;
+        uint32_t best_lead = 0;
+        for (rect16* it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+            if (beam >= it->y1 && beam <= it->y2) continue;
+            uint32_t lead = vsync_lead(beam, *it);
+            if (best == nullptr || lead > best_lead) {
+                best = it;
+                best_lead = lead;
+            }
+        }
+        if (best == nullptr) {
+            // the beam is inside every tile. Take the first, and the flush
+            // will be held until it has moved on.
+            best = m_tiles.begin();
+        }
+        out = *best;
+        m_tiles.erase(best, best);
+        return plan_status::has_tile;
+    }
+
     plan_status next_tile(rect16& out) {
+        if (m_vsync_frame) {
+            return vsync_next(out);
+        }
         switch (m_active_strategy) {
             case screen_update_strategy::throughput:
                 return throughput_next(out);
@@ -528,8 +751,390 @@ class screen_ex final : public screen_base {
         }
     }
 
+    // (re)allocates the dirty cell bitmap for the current dimensions. This is
+    // the only place the cell backend allocates.
+    uix_result cells_resize() {
+        m_cells.clear();
+        m_cells_across = 0;
+        m_cells_down = 0;
+        m_cells_dirty = false;
+        if (DirtyCellSize == 0 || m_dimensions.width < 1 ||
+            m_dimensions.height < 1) {
+            return uix_result::success;
+        }
+        uint16_t across = (uint16_t)((m_dimensions.width + dirty_cell_width - 1) /
+                                     dirty_cell_width);
+        uint16_t down = (uint16_t)((m_dimensions.height + dirty_cell_height - 1) /
+                                   dirty_cell_height);
+        size_t words = ((size_t)across * down + 31) / 32;
+        for (size_t i = 0; i < words; ++i) {
+            if (!m_cells.push_back(0)) {
+                // fall back to the rect list
+                m_cells.clear();
+                return uix_result::out_of_memory;
+            }
+        }
+        m_cells_across = across;
+        m_cells_down = down;
+        return uix_result::success;
+    }
+    bool cell(uint16_t cx, uint16_t cy) const {
+        size_t i = (size_t)cy * m_cells_across + cx;
+        return (m_cells.cbegin()[i >> 5] & (1U << (i & 31))) != 0;
+    }
+    void cells_clear() {
+        for (uint32_t* it = m_cells.begin(); it != m_cells.end(); ++it) {
+            *it = 0;
+        }
+        m_cells_dirty = false;
+    }
+    void cells_mark(const rect16& r) {
+        uint16_t cx1 = r.x1 / dirty_cell_width, cx2 = r.x2 / dirty_cell_width;
+        uint16_t cy1 = r.y1 / dirty_cell_height, cy2 = r.y2 / dirty_cell_height;
+        uint32_t* cells = m_cells.begin();
+        for (uint16_t cy = cy1; cy <= cy2; ++cy) {
+            size_t i = (size_t)cy * m_cells_across + cx1;
+            for (uint16_t cx = cx1; cx <= cx2; ++cx, ++i) {
+                cells[i >> 5] |= (1U << (i & 31));
+            }
+        }
+        m_cells_dirty = true;
+    }
+    // turns the dirty cells into rects for the planner: one per run of cells
+    // in a row, stacked with the run above when it spans the same columns.
+    // The bitmap is then cleared to collect the next frame's damage.
+    void cells_collect() {
+        const size_t first = m_dirty_rects.size();
+        for (uint16_t cy = 0; cy < m_cells_down; ++cy) {
+            uint16_t y1 = (uint16_t)(cy * dirty_cell_height);
+            int y2 = (int)y1 + dirty_cell_height - 1;
+            if (y2 >= m_dimensions.height) y2 = m_dimensions.height - 1;
+            uint16_t cx = 0;
+            while (cx < m_cells_across) {
+                if (!cell(cx, cy)) {
+                    ++cx;
+                    continue;
+                }
+                uint16_t start = cx;
+                while (cx < m_cells_across && cell(cx, cy)) ++cx;
+                int x2 = (int)cx * dirty_cell_width - 1;
+                if (x2 >= m_dimensions.width) x2 = m_dimensions.width - 1;
+                rect16 run((uint16_t)(start * dirty_cell_width), y1,
+                           (uint16_t)x2, (uint16_t)y2);
+                bool stacked = false;
+                for (rect16* it = m_dirty_rects.begin() + first;
+                     it != m_dirty_rects.end(); ++it) {
+                    if (it->x1 == run.x1 && it->x2 == run.x2 &&
+                        (int)it->y2 + 1 == (int)run.y1) {
+                        it->y2 = run.y2;
+                        stacked = true;
+                        break;
+                    }
+                }
+                if (!stacked && !m_dirty_rects.push_back(run)) {
+                    // out of memory. Drop the runs emitted so far, since the
+                    // cells stay set and are collected again next update.
+                    if (m_dirty_rects.size() > first) {
+                        m_dirty_rects.erase(m_dirty_rects.begin() + first,
+                                            m_dirty_rects.end() - 1);
+                    }
+                    return;
+                }
+            }
+        }
+        cells_clear();
+    }
+    // adds r to a dirty set, merging it with any rects it overlaps
+    static uix_result add_dirty(dirty_rects_type& set, rect16 r) {
+        for (rect16* it = set.begin(); it != set.end(); ++it) {
+            if (it->contains(r)) {
+                return uix_result::success;
+            }
+        }
+        bool done = false;
+        while (!done) {
+            done = true;
+            for (rect16* it = set.begin(); it != set.end(); ++it) {
+                if (!it->contains(r) && !r.contains(*it) && r.intersects(*it)) {
+                    r = r.merge(*it);
+                    done = false;
+                    break;
+                }
+            }
+        }
+        for (rect16* it = set.begin(); it != set.end(); ++it) {
+            if (r.contains(*it)) {
+                set.erase(it, it);
+                --it;
+            }
+        }
+        return set.push_back(r) ? uix_result::success
+                                : uix_result::out_of_memory;
+    }
+    // true if r lies entirely within area this frame has yet to render, so
+    // invalidating it now needs no repaint next frame
+    bool pending_covers(const rect16& r) const {
+        if (m_il_active && m_il_y <= m_il_tile.y2 &&
+            rect16(m_il_tile.x1, m_il_y, m_il_tile.x2, m_il_tile.y2)
+                .contains(r)) {
+            return true;
+        }
+        if (m_vsync_frame) {
+            for (const rect16* it = m_tiles.cbegin(); it != m_tiles.cend();
+                 ++it) {
+                if (it->contains(r)) return true;
+            }
+            return false;
+        }
+        if (m_it_dirties == nullptr || m_it_dirties == m_dirty_rects.cend()) {
+            return false;
+        }
+        typename dirty_rects_type::const_iterator it = m_it_dirties;
+        if (m_active_strategy == screen_update_strategy::throughput ||
+            m_active_strategy == screen_update_strategy::balanced) {
+            // rows of the current rect from the strip cursor down
+            rect16 d = align_up(*it);
+            if (m_strip_y <= d.y2 &&
+                rect16(d.x1, m_strip_y, d.x2, d.y2).contains(r)) {
+                return true;
+            }
+            ++it;
+        } else {
+            // the guillotine has already advanced past the rect it's working
+            if (m_banding && m_band_region.contains(r)) return true;
+            for (uint8_t i = 0; i < m_sp; ++i) {
+                if (m_region_stack[i].contains(r)) return true;
+            }
+        }
+        for (; it != m_dirty_rects.cend(); ++it) {
+            if (align_up(*it).contains(r)) return true;
+        }
+        return false;
+    }
+    // moves damage that arrived while rendering into the current set
+    uix_result merge_next_dirty() {
+        uix_result res = uix_result::success;
+        for (const rect16* it = m_next_dirty.cbegin();
+             it != m_next_dirty.cend(); ++it) {
+            if (add_dirty(m_dirty_rects, *it) != uix_result::success) {
+                res = uix_result::out_of_memory;
+            }
+        }
+        m_next_dirty.clear();
+        return res;
+    }
+    // hands the damage controls have been holding to invalidate(), so
+    // property changes made since the last update are merged in one pass
+    uix_result collect_controls() {
+        if (!m_controls_invalid) {
+            return uix_result::success;
+        }
+        m_controls_invalid = false;
+        uix_result res = uix_result::success;
+        for (typename controls_type::iterator it = m_controls.begin();
+             it != m_controls.end(); ++it) {
+            if (it->ctrl->flush_invalidation() != uix_result::success) {
+                res = uix_result::out_of_memory;
+            }
+        }
+        return res;
+    }
+    // holds r until the batch ends, folding it into the last held rect when
+    // that covers no more than the two would separately
+    uix_result batch_add(const rect16& r) {
+        if (m_batch.size() != 0) {
+            rect16& last = *(m_batch.end() - 1);
+            const rect16 u = last.merge(r);
+            if ((uint32_t)u.width() * u.height() <=
+                (uint32_t)last.width() * last.height() +
+                    (uint32_t)r.width() * r.height()) {
+                last = u;
+                return uix_result::success;
+            }
+        }
+        return m_batch.push_back(r) ? uix_result::success
+                                    : invalidate_now(r);
+    }
+    // adds damage to whichever set the current state calls for
+    uix_result invalidate_now(const rect16& r) {
+        if (m_cells.size() != 0) {
+            // cells marked during a frame are collected for the next
+            if (m_rendering && m_merge_next_frame && pending_covers(r)) {
+                return uix_result::success;
+            }
+            cells_mark(r);
+            return uix_result::success;
+        }
+        if (m_rendering) {
+            // the current set is frozen while the frame is planned from it
+            if (m_merge_next_frame && pending_covers(r)) {
+                return uix_result::success;
+            }
+            return add_dirty(m_next_dirty, r);
+        }
+        return add_dirty(m_dirty_rects, r);
+    }
+    // drops damage that controls and batches have yet to hand over
+    void discard_held() {
+        m_batch.clear();
+        if (m_controls_invalid) {
+            m_controls_invalid = false;
+            for (typename controls_type::iterator it = m_controls.begin();
+                 it != m_controls.end(); ++it) {
+                it->ctrl->validate();
+            }
+        }
+    }
+    // the frame is done: its damage is repaired and next frame's becomes
+    // current
+    uix_result commit_dirty() {
+        m_dirty_rects.clear();
+        return merge_next_dirty();
+    }
+
+    // microseconds from a monotonic clock. clock() is processor time, which
+    // is coarse on some platforms and doesn't advance while waiting on a
+    // transfer on others. Only differences are used, so wrapping is fine.
+    static uint32_t timing_now() {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+    // microseconds per 64KB, so per-frame samples of different sizes compare
+    static uint32_t cost_per_64k(uint32_t us, size_t bytes) {
+        return (uint32_t)(((uint64_t)us << 16) / bytes);
+    }
+    static void cost_sample(uint32_t& ema, uint32_t sample) {
+        ema = (ema == 0) ? sample : ema - (ema >> 2) + (sample >> 2);
+    }
+    // whether splitting buffer1 pays off by the current estimates. The
+    // thresholds differ by direction: split when the overlap would save at
+    // least a quarter, only go back when it would save less than an eighth
+    bool split_pays() const {
+        uint64_t lo = m_paint_cost < m_stall_cost ? m_paint_cost : m_stall_cost;
+        uint64_t sum = (uint64_t)m_paint_cost + m_stall_cost;
+        return m_split ? (lo * 8 >= sum) : (lo != 0 && lo * 4 >= sum);
+    }
+    void sample_frame_timing() {
+        if (m_frame_bytes == 0) return;
+        uint32_t total = timing_now() - m_frame_start;
+        cost_sample(m_paint_cost, cost_per_64k(m_paint_us, m_frame_bytes));
+        // an unsplit single buffer frame is fully serialized, so any time not
+        // spent painting or inside the flush callback was spent waiting on the
+        // previous (asynchronous) transfer. The last tile's flush is still in
+        // flight, so it isn't counted. While split the wait overlaps painting
+        // and can't be measured, so the last estimate from before the split
+        // stands.
+        if (!m_split && m_buffer2 == nullptr && m_frame_timed &&
+            m_frame_bytes > m_last_tile_bytes) {
+            uint32_t busy = m_paint_us + m_flush_call_us;
+            uint32_t stall = total > busy ? total - busy : 0;
+            cost_sample(m_stall_cost,
+                        cost_per_64k(stall, m_frame_bytes - m_last_tile_bytes));
+        }
+        // a single frame that disagrees doesn't change the layout. It has to
+        // be outvoted for split_frames frames in a row.
+        if (m_buffer2 == nullptr && split_pays() != m_split) {
+            if (m_split_votes < split_frames) ++m_split_votes;
+        } else {
+            m_split_votes = 0;
+        }
+    }
+    // With only buffer1 supplied, decide whether to split it into two halves
+    // so that painting one tile overlaps the transfer of the last. That pays
+    // off when both painting and waiting on the flush cost a comparable
+    // amount. Returns false if the layout needs to change but a transfer out
+    // of buffer1 is still in flight.
+    bool adapt_buffers() {
+        if (m_buffer2 != nullptr || m_split_votes < split_frames) return true;
+        bool split = !m_split;
+        if (m_flushing || m_flush_pending) return false;
+        m_split_votes = 0;
+        if (split) {
+            size_t half = (m_buffer_size / 2) & ~(size_t)3;
+            if (half < native_bitmap_type::sizeof_buffer(
+                           size16(dimensions().width, vertical_alignment))) {
+                return true;
+            }
+            m_split_size = half;
+            m_split = true;
+        } else {
+            m_split = false;
+        }
+        m_write_buffer = m_buffer1;
+        return true;
+    }
+
+    // the interlace band holding row y, cropped to the current tile
+    rect16 il_band(int y) const {
+        int lines = v_align_up((int)m_interlace_lines);
+        int y1 = y - y % lines;
+        int y2 = y1 + lines - 1;
+        if (y1 < m_il_tile.y1) y1 = m_il_tile.y1;
+        if (y2 > m_il_tile.y2) y2 = m_il_tile.y2;
+        return rect16(m_il_tile.x1, (uint16_t)y1, m_il_tile.x2, (uint16_t)y2);
+    }
+    // a band can sit this frame out if it's off phase and only interlaced
+    // controls are showing in it
+    bool il_skip(const rect16& band) const {
+        int lines = v_align_up((int)m_interlace_lines);
+        if (((band.y1 / lines) & 1) == m_il_phase) return false;
+        srect16 sb = (srect16)band;
+        bool covered = false;
+        for (typename controls_type::const_iterator it = m_controls.cbegin();
+             it != m_controls.cend(); ++it) {
+            control_type* p = it->ctrl;
+            if (!p->visible() || !p->bounds().intersects(sb)) continue;
+            if (!p->interlaced()) return false;
+            if (p->bounds().contains(sb)) covered = true;
+        }
+        return covered;
+    }
+    // filters tiles from the planner into runs of bands to send this frame.
+    // Skipped bands are queued for the next frame, which has the other phase.
+    plan_status interlace_next(rect16& out) {
+        for (;;) {
+            if (!m_il_active) {
+                plan_status st = next_tile(m_il_tile);
+                if (st != plan_status::has_tile) return st;
+                m_il_y = m_il_tile.y1;
+                m_il_active = true;
+            }
+            int y = m_il_y;
+            while (y <= m_il_tile.y2) {
+                rect16 band = il_band(y);
+                if (!il_skip(band) ||
+                    add_dirty(m_next_dirty, band) != uix_result::success) {
+                    break;
+                }
+                y = band.y2 + 1;
+            }
+            int y1 = y;
+            while (y <= m_il_tile.y2) {
+                rect16 band = il_band(y);
+                if (il_skip(band)) break;
+                y = band.y2 + 1;
+            }
+            m_il_y = (uint16_t)y;
+            if (y > m_il_tile.y2) m_il_active = false;
+            if (y1 == y) continue;  // the rest of the tile was skipped
+            out = rect16(m_il_tile.x1, (uint16_t)y1, m_il_tile.x2,
+                         (uint16_t)(y - 1));
+            return plan_status::has_tile;
+        }
+    }
+
     void planner_init() {
         m_rendering = true;
+        m_il_active = false;
+        if (m_interlace_lines != 0) {
+            m_il_phase ^= 1;
+        }
+        m_frame_start = timing_now();
+        m_paint_us = 0;
+        m_flush_call_us = 0;
+        m_frame_bytes = 0;
+        m_last_tile_bytes = 0;
         m_active_strategy = m_update_strategy;
         m_it_dirties = m_dirty_rects.cbegin();
         // too many disjoint dirty rects for the guillotine stack? degrade.
@@ -544,6 +1149,30 @@ class screen_ex final : public screen_base {
             m_sp = 0;
             m_banding = false;
         }
+        m_vsync_frame = false;
+        m_tiles.clear();
+        if (vsync_enabled()) {
+            // plan the whole frame up front so tiles can be taken in beam
+            // order. If it doesn't fit, fall back to streaming the plan.
+            rect16 tile;
+            plan_status st;
+            while ((st = next_tile(tile)) == plan_status::has_tile) {
+                if (!m_tiles.push_back(tile)) break;
+            }
+            if (st == plan_status::done) {
+                m_vsync_frame = true;
+            } else {
+                m_tiles.clear();
+                m_it_dirties = m_dirty_rects.cbegin();
+                if (m_active_strategy == screen_update_strategy::throughput ||
+                    m_active_strategy == screen_update_strategy::balanced) {
+                    m_strip_y = align_up(*m_it_dirties).y1;
+                } else {
+                    m_sp = 0;
+                    m_banding = false;
+                }
+            }
+        }
     }
 
     void finalize_paint() {
@@ -558,6 +1187,9 @@ class screen_ex final : public screen_base {
         m_rendering = false;
         m_banding = false;
         m_sp = 0;
+        m_vsync_frame = false;
+        m_tiles.clear();
+        m_il_active = false;
     }
 
     // identical to your existing per-band paint loop; shared by all strategies
@@ -621,11 +1253,23 @@ class screen_ex final : public screen_base {
         }
     }
     uix_result update_impl() {
+        if (vsync_enabled()) {
+            vsync_sample_flush();
+        }
+        collect_controls();
+        if (m_cells_dirty && !m_rendering) {
+            cells_collect();
+        }
         // we had to early exit the last time
         if (m_flush_pending) {
             if (m_flushing) {
                 return uix_result::success;
             }
+            // hold the tile until the beam is clear of it
+            if (m_vsync_frame &&
+                !vsync_safe(vsync_beam(), m_flush_pending_bounds)) {
+                return uix_result::success;
+            }
             // Serial.println("Initiating pending flush");
             m_flushing = 1;
             m_flush_pending = false;
@@ -634,6 +1278,7 @@ class screen_ex final : public screen_base {
             // initiate the DMA transfer on whatever was *previously*
             // m_write_buffer before switch_buffers was called.
             // delay(50);
+            vsync_flush_started(m_flush_pending_bounds);
             m_on_flush_callback(
                 m_flush_pending_bounds, buf,
                 m_on_flush_callback_state);  // initiate DMA transfer
@@ -693,6 +1338,8 @@ class screen_ex final : public screen_base {
                     m_last_touched = nullptr;
                 }
             }
+            // controls changed by touch are drawn this frame
+            collect_controls();
         }
         switch (m_update_mode) {
                 // rendering process
@@ -700,36 +1347,53 @@ class screen_ex final : public screen_base {
             case screen_update_mode::partial: {
                 if (m_on_flush_callback != nullptr && m_buffer_size != 0 &&
                     m_buffer1 != nullptr && m_dirty_rects.size() != 0) {
+                    if (!m_rendering && !adapt_buffers()) {
+                        return uix_result::success;
+                    }
                     // single-buffer: wait for the in-flight flush to finish
-                    if (m_buffer2 == nullptr && m_flushing) {
+                    if (second_buffer() == nullptr && m_flushing) {
                         return uix_result::success;
                     }
                     if (!m_rendering) {
                         planner_init();
                     }
                     rect16 tile;
-                    plan_status st = next_tile(tile);
+                    plan_status st = m_interlace_lines != 0
+                                         ? interlace_next(tile)
+                                         : next_tile(tile);
                     if (st == plan_status::out_of_memory) {
                         finalize_paint();
+                        merge_next_dirty();
                         return uix_result::out_of_memory;
                     }
                     if (st == plan_status::done) {
+                        sample_frame_timing();
                         finalize_paint();
-                        return validate_all();
+                        return commit_dirty();
                     }
                     srect16 subrect = (srect16)tile;
                     uint8_t* buf = (uint8_t*)m_write_buffer;
+                    uint32_t start = timing_now();
                     render_subrect(subrect, buf);
-                    // DMA double-buffer early-exit (unchanged)
-                    if (m_buffer2 != nullptr && m_flushing) {
+                    m_paint_us += timing_now() - start;
+                    m_last_tile_bytes = native_bitmap_type::sizeof_buffer(
+                        size16(tile.width(), tile.height()));
+                    m_frame_bytes += m_last_tile_bytes;
+                    // DMA double-buffer early-exit, or the beam would tear the
+                    // tile
+                    if ((second_buffer() != nullptr && m_flushing) ||
+                        (m_vsync_frame && !vsync_safe(vsync_beam(), tile))) {
                         m_flush_pending_bounds = (rect16)subrect;
                         m_flush_pending = true;
                         return uix_result::success;
                     }
                     switch_buffers();
                     m_flushing = 1;
+                    vsync_flush_started(tile);
+                    start = timing_now();
                     m_on_flush_callback((rect16)subrect, buf,
                                         m_on_flush_callback_state);
+                    m_flush_call_us += timing_now() - start;
                 }
             } break;
             case screen_update_mode::direct: {
@@ -745,6 +1409,8 @@ class screen_ex final : public screen_base {
 
                 uint8_t* target = (uint8_t*)m_write_buffer;
                 bitmap_type bmp((size16)this->dimensions(), target, m_palette);
+                // invalidations from here on go to the next frame
+                m_rendering = true;
 
                 // Fill + paint the current dirty rects.
                 for (auto it_d = m_dirty_rects.cbegin();
@@ -770,6 +1436,7 @@ class screen_ex final : public screen_base {
                         it->state = 0;
                     }
                 }
+                m_rendering = false;
 
                 // ONE flush for the whole updated buffer. For a two-buffer RGB swap
                 // this should be the full screen (whole-buffer swap semantics); for
@@ -790,7 +1457,7 @@ class screen_ex final : public screen_base {
                     }
                     switch_buffers();
                 }
-                return validate_all();
+                return commit_dirty();
             } break;
             default:
                 break;
@@ -828,6 +1495,43 @@ class screen_ex final : public screen_base {
     uint8_t m_sp;                                     // stack pointer
     bool m_banding;                                   // guillotine forced-band fallback active
     rect16 m_band_region;                             // remaining region being force-banded
+    bool m_split;                                     // buffer1 is split into two ping-pong halves
+    size_t m_split_size;                              // size of each half while split
+    static constexpr uint8_t split_frames = 8;        // frames in a row that must favor the other layout
+    uint8_t m_split_votes;                            // frames in a row that favored the other layout
+    uint32_t m_frame_start;                           // timing_now() at the start of the frame
+    uint32_t m_paint_us;                              // microseconds spent painting this frame
+    uint32_t m_flush_call_us;                         // microseconds spent inside the flush callback this frame
+    size_t m_frame_bytes;                             // bytes rendered this frame
+    size_t m_last_tile_bytes;                         // bytes in the most recent tile
+    bool m_frame_timed;                               // frame ran in one update() call
+    uint32_t m_paint_cost;                            // paint microseconds per 64KB (average)
+    uint32_t m_stall_cost;                            // async flush wait microseconds per 64KB (average)
+    on_vsync_callback_type m_on_vsync_callback;
+    void* m_on_vsync_callback_state;
+    uint32_t m_vsync_line_period;                     // panel line time, in vsync callback units
+    uint32_t m_vsync_line_count;                      // lines per refresh (0 = screen height)
+    bool m_vsync_frame;                               // this frame is scheduled against the beam
+    dirty_rects_type m_tiles;                         // planned tiles not yet rendered (vsync)
+    uint32_t m_vsync_write_cost;                      // transfer time per byte, 16.16 (average)
+    uint32_t m_vsync_flush_start;                     // vsync time the last transfer started
+    size_t m_vsync_flush_bytes;                       // bytes in the last transfer, 0 once timed
+    dirty_rects_type m_next_dirty;                    // damage reported while rendering
+    bool m_merge_next_frame;                          // fold new damage into unrendered tiles
+    dirty_cells_type m_cells;                         // dirty cell bitmap (DirtyCellSize != 0)
+    uint16_t m_cells_across;                          // cell columns
+    uint16_t m_cells_down;                            // cell rows
+    bool m_cells_dirty;                               // any cell marked since the last collect
+    uint16_t m_interlace_lines;                       // interlace band height (0 = off)
+    int m_il_phase;                                   // which bands (even/odd) go this frame
+    bool m_il_active;                                 // a tile is being split into bands
+    rect16 m_il_tile;                                 // the tile being split
+    uint16_t m_il_y;                                  // the next row of m_il_tile to consider
+    image_cache* m_decoded_image_cache;               // decoded images kept across frames
+    glyph_atlas* m_text_glyph_atlas;                  // rasterized glyphs shared by text controls
+    bool m_controls_invalid;                          // a control holds an invalidation to collect
+    dirty_rects_type m_batch;                         // damage held until the batch ends
+    uint8_t m_batch_depth;                            // begin_batch() nesting (0 = not batching)
 
    public:
     /// @brief Constructs a screen given a buffer size, and one or two buffers,
@@ -876,7 +1580,44 @@ class screen_ex final : public screen_base {
           m_rendering(false),
           m_strip_y(false),
           m_sp(0),
-          m_banding(false) {}
+          m_banding(false),
+          m_split(false),
+          m_split_size(0),
+          m_split_votes(0),
+          m_frame_start(0),
+          m_paint_us(0),
+          m_flush_call_us(0),
+          m_frame_bytes(0),
+          m_last_tile_bytes(0),
+          m_frame_timed(false),
+          m_paint_cost(0),
+          m_stall_cost(0),
+          m_on_vsync_callback(nullptr),
+          m_on_vsync_callback_state(nullptr),
+          m_vsync_line_period(0),
+          m_vsync_line_count(0),
+          m_vsync_frame(false),
+          m_tiles(allocator, reallocator, deallocator),
+          m_vsync_write_cost(0),
+          m_vsync_flush_start(0),
+          m_vsync_flush_bytes(0),
+          m_next_dirty(allocator, reallocator, deallocator),
+          m_merge_next_frame(true),
+          m_cells(allocator, reallocator, deallocator),
+          m_cells_across(0),
+          m_cells_down(0),
+          m_cells_dirty(false),
+          m_interlace_lines(0),
+          m_il_phase(0),
+          m_il_active(false),
+          m_il_y(0),
+          m_decoded_image_cache(nullptr),
+          m_text_glyph_atlas(&default_glyph_atlas()),
+          m_controls_invalid(false),
+          m_batch(allocator, reallocator, deallocator),
+          m_batch_depth(0) {
+        cells_resize();
+    }
     /// @brief Constructs an uninitialized screen instance
     /// @param allocator The memory allocator to use for the controls (malloc)
     /// @param reallocator The memory reallocator to use for the controls
@@ -911,7 +1652,44 @@ class screen_ex final : public screen_base {
           m_rendering(false),
           m_strip_y(false),
           m_sp(0),
-          m_banding(false) {}
+          m_banding(false),
+          m_split(false),
+          m_split_size(0),
+          m_split_votes(0),
+          m_frame_start(0),
+          m_paint_us(0),
+          m_flush_call_us(0),
+          m_frame_bytes(0),
+          m_last_tile_bytes(0),
+          m_frame_timed(false),
+          m_paint_cost(0),
+          m_stall_cost(0),
+          m_on_vsync_callback(nullptr),
+          m_on_vsync_callback_state(nullptr),
+          m_vsync_line_period(0),
+          m_vsync_line_count(0),
+          m_vsync_frame(false),
+          m_tiles(allocator, reallocator, deallocator),
+          m_vsync_write_cost(0),
+          m_vsync_flush_start(0),
+          m_vsync_flush_bytes(0),
+          m_next_dirty(allocator, reallocator, deallocator),
+          m_merge_next_frame(true),
+          m_cells(allocator, reallocator, deallocator),
+          m_cells_across(0),
+          m_cells_down(0),
+          m_cells_dirty(false),
+          m_interlace_lines(0),
+          m_il_phase(0),
+          m_il_active(false),
+          m_il_y(0),
+          m_decoded_image_cache(nullptr),
+          m_text_glyph_atlas(&default_glyph_atlas()),
+          m_controls_invalid(false),
+          m_batch(allocator, reallocator, deallocator),
+          m_batch_depth(0) {
+        cells_resize();
+    }
     /// @brief Moves a screen
     /// @param rhs The screen to move
     screen_ex(screen_ex&& rhs) { do_move_control(rhs); }
@@ -932,6 +1710,7 @@ class screen_ex final : public screen_base {
             return;
         }
         m_dimensions = value;
+        cells_resize();
         // TODO: implement a resize event
     }
     /// @brief Indicates the bounds of the screen. This is
@@ -951,6 +1730,7 @@ class screen_ex final : public screen_base {
     /// @brief Sets the update mode for the screen
     /// @param value The update mode
     virtual void update_mode(screen_update_mode value) override {
+        reset_split();
         m_update_mode = value;
     }
     /// @brief The strategy used to update the screen, either favoring minimum redraws, minimum transfers, or balanced
@@ -963,18 +1743,34 @@ class screen_ex final : public screen_base {
     virtual void update_strategy(screen_update_strategy value) override {
         m_update_strategy = value;
     }
+    /// @brief Indicates the height of the interlace bands in partial mode
+    /// @return The band height in lines, or 0 if interlacing is off
+    virtual uint16_t interlace_lines() const override {
+        return m_interlace_lines;
+    }
+    /// @brief Sets the height of the interlace bands in partial mode. Where
+    /// interlaced controls are being updated, alternating bands are sent on
+    /// alternating frames. The height is rounded up to the vertical alignment.
+    /// @param value The band height in lines, or 0 to turn interlacing off
+    virtual void interlace_lines(uint16_t value) override {
+        m_interlace_lines = value;
+    }
     /// @brief Indicates the size of the transfer buffer(s)
     /// @return a size_t containing the size of the buffer
     virtual size_t buffer_size() const override { return m_buffer_size; }
     /// @brief Sets the size of the transfer buffer(s)
     /// @param value the new buffer size
-    virtual void buffer_size(size_t value) override { m_buffer_size = value; }
+    virtual void buffer_size(size_t value) override {
+        reset_split();
+        m_buffer_size = value;
+    }
     /// @brief Gets the first or only buffer
     /// @return A pointer to the buffer
     virtual uint8_t* buffer1() override { return m_buffer1; }
     /// @brief Sets the first or only buffer
     /// @param buffer A pointer to the new buffer
     virtual void buffer1(uint8_t* buffer) override {
+        reset_split();
         m_buffer1 = buffer;
         if (m_write_buffer == nullptr || m_write_buffer != m_buffer2) {
             m_write_buffer = buffer;
@@ -986,6 +1782,7 @@ class screen_ex final : public screen_base {
     /// @brief Sets the second buffer
     /// @param buffer A pointer to the new buffer
     virtual void buffer2(uint8_t* buffer) override {
+        reset_split();
         m_buffer2 = buffer;
         if (m_write_buffer == nullptr || m_write_buffer != m_buffer1) {
             m_write_buffer = buffer;
@@ -1015,37 +1812,11 @@ class screen_ex final : public screen_base {
         if (bounds().intersects(rect)) {
             rect16 r = (rect16)rect.crop(bounds());
             r.normalize_inplace();
-            for (rect16* it = m_dirty_rects.begin(); it != m_dirty_rects.end();
-                 ++it) {
-                if (it->contains(r)) {
-                    // // Serial.printf("Dirty rects count:
-                    // %d\n",m_dirty_rects.size());
-                    return uix_result::success;
-                }
-            }
-            bool done = false;
-            while (!done) {
-                done = true;
-                for (rect16* it = m_dirty_rects.begin();
-                     it != m_dirty_rects.end(); ++it) {
-                    if (!it->contains(r) && !r.contains(*it) &&
-                        r.intersects(*it)) {
-                        r = r.merge(*it);
-                        done = false;
-                        break;
-                    }
-                }
-            }
-            for (rect16* it = m_dirty_rects.begin(); it != m_dirty_rects.end();
-                 ++it) {
-                if (r.contains(*it)) {
-                    m_dirty_rects.erase(it, it);
-                    --it;
-                }
+            // marking cells is already cheap, so there's nothing to batch
+            if (m_batch_depth != 0 && m_cells.size() == 0) {
+                return batch_add(r);
             }
-            // // Serial.printf("Dirty rects count: %d\n",m_dirty_rects.size());
-            return m_dirty_rects.push_back(r) ? uix_result::success
-                                              : uix_result::out_of_memory;
+            return invalidate_now(r);
         }
         // // Serial.printf("Dirty rects count: %d\n",m_dirty_rects.size());
         return uix_result::success;
@@ -1054,14 +1825,67 @@ class screen_ex final : public screen_base {
     /// @return The result of the operation
     virtual uix_result validate_all() override {
         // // Serial.println("validate all");
+        if (m_rendering) {
+            // the frame in progress still needs its damage. Only drop what
+            // was queued for the next one.
+            m_next_dirty.clear();
+            cells_clear();
+            discard_held();
+            return uix_result::success;
+        }
         m_dirty_rects.clear();
+        m_next_dirty.clear();
+        cells_clear();
+        discard_held();
         return uix_result::success;
     }
+    /// @brief Indicates whether controls hold their invalidations until the
+    /// next update(). Screens collect them from their registered controls.
+    /// @return True
+    virtual bool defers_invalidation() const override {
+        return true;
+    }
+    /// @brief Called by a registered control after it starts holding an
+    /// invalidation, so it is collected at the next update()
+    virtual void control_invalidation_held() override {
+        m_controls_invalid = true;
+    }
+    /// @brief Begins a batch. Until the matching end_batch(), invalidated
+    /// regions are held and merged into the dirty set all at once. Batches
+    /// may be nested.
+    virtual void begin_batch() override {
+        ++m_batch_depth;
+    }
+    /// @brief Ends a batch begun with begin_batch(). When the outermost batch
+    /// ends, the regions invalidated during it are merged into the dirty set.
+    /// @return The result of the operation
+    virtual uix_result end_batch() override {
+        if (m_batch_depth == 0) {
+            return uix_result::invalid_state;
+        }
+        if (--m_batch_depth != 0) {
+            return uix_result::success;
+        }
+        uix_result res = uix_result::success;
+        for (const rect16* it = m_batch.cbegin(); it != m_batch.cend();
+             ++it) {
+            if (invalidate_now(*it) != uix_result::success) {
+                res = uix_result::out_of_memory;
+            }
+        }
+        m_batch.clear();
+        return res;
+    }
     /// @brief Unregisters all of the controls
     /// @return The result of the operation
     uix_result unregister_controls() {
         bool should_invalidate = m_controls.size() == 0;
         validate_all();
+        // controls that aren't collected from anymore pass invalidations on
+        for (typename controls_type::iterator it = m_controls.begin();
+             it != m_controls.end(); ++it) {
+            it->ctrl->defer_invalidation(false);
+        }
         m_controls.clear();
         if (should_invalidate) {
             return invalidate();
@@ -1077,6 +1901,8 @@ class screen_ex final : public screen_base {
         entry.state = 0;
         if (m_controls.push_back(entry)) {
             control.parent(*this);
+            // held invalidations are collected from registered controls only
+            control.defer_invalidation(true);
             return invalidate(control.bounds());
         }
         return uix_result::out_of_memory;
@@ -1149,6 +1975,84 @@ class screen_ex final : public screen_base {
         m_on_touch_callback = callback;
         m_on_touch_callback_state = state;
     }
+    /// @brief Retrieves the vsync callback
+    /// @return A pointer to the callback method
+    virtual on_vsync_callback_type on_vsync_callback() const override {
+        return m_on_vsync_callback;
+    }
+    /// @brief Retrieves the vsync callback state
+    /// @return The user defined vsync callback state
+    virtual void* on_vsync_callback_state() const override {
+        return m_on_vsync_callback_state;
+    }
+    /// @brief Sets the vsync callback. When set along with a line period, tiles
+    /// are scheduled and flushed so they stay behind the panel's scan line.
+    /// This is experimental, and has no effect unless UIX_EXPERIMENTAL_VSYNC
+    /// is defined.
+    /// @param callback The callback that reports the time of the last vsync
+    /// (TE) pulse and the current time, in the same units
+    /// @param state A user defined state value to pass to the callback
+    virtual void on_vsync_callback(on_vsync_callback_type callback,
+                                   void* state = nullptr) override {
+        m_on_vsync_callback = callback;
+        m_on_vsync_callback_state = state;
+    }
+    /// @brief Indicates the time the panel takes to scan one line
+    /// @return The line period, in the units reported by the vsync callback
+    virtual uint32_t vsync_line_period() const override {
+        return m_vsync_line_period;
+    }
+    /// @brief Sets the time the panel takes to scan one line
+    /// @param value The line period, in the units reported by the vsync
+    /// callback
+    virtual void vsync_line_period(uint32_t value) override {
+        m_vsync_line_period = value;
+    }
+    /// @brief Indicates the number of lines in one panel refresh, including
+    /// blanking
+    /// @return The line count, or 0 to use the screen height
+    virtual uint32_t vsync_line_count() const override {
+        return m_vsync_line_count;
+    }
+    /// @brief Sets the number of lines in one panel refresh, including
+    /// blanking
+    /// @param value The line count, or 0 to use the screen height
+    virtual void vsync_line_count(uint32_t value) override {
+        m_vsync_line_count = value;
+    }
+    /// @brief Indicates whether damage reported while a frame is rendering is
+    /// folded into that frame when it lies in tiles that haven't been rendered
+    /// yet
+    /// @return True if damage is merged into the frame in progress, otherwise
+    /// false
+    bool merge_next_frame() const { return m_merge_next_frame; }
+    /// @brief Sets whether damage reported while a frame is rendering is
+    /// folded into that frame when it lies in tiles that haven't been rendered
+    /// yet. Otherwise it is always deferred to the next frame.
+    /// @param value True to merge, otherwise false
+    void merge_next_frame(bool value) { m_merge_next_frame = value; }
+    /// @brief Indicates the cache controls keep decoded images in across frames
+    /// @return The image cache, or null if there is none
+    virtual image_cache* decoded_image_cache() const override {
+        return m_decoded_image_cache;
+    }
+    /// @brief Sets the cache controls keep decoded images in across frames.
+    /// The cache is not owned by the screen, and may be shared between screens
+    /// @param value The image cache, or null to decode images every frame
+    virtual void decoded_image_cache(image_cache* value) override {
+        m_decoded_image_cache = value;
+    }
+    /// @brief Indicates the atlas text controls share rasterized glyphs through
+    /// @return The glyph atlas, or null if there is none
+    virtual glyph_atlas* text_glyph_atlas() const override {
+        return m_text_glyph_atlas;
+    }
+    /// @brief Sets the atlas text controls share rasterized glyphs through.
+    /// Screens use default_glyph_atlas() unless told otherwise. The atlas is not owned by the screen.
+    /// @param value The glyph atlas, or null to have each control use its own caches
+    virtual void text_glyph_atlas(glyph_atlas* value) override {
+        m_text_glyph_atlas = value;
+    }
     virtual bool flush_pending() const {
         return m_flush_pending || m_flushing;
     }
@@ -1158,6 +2062,13 @@ class screen_ex final : public screen_base {
     /// subrect iteration rather than all dirty rectangles
     /// @return The result of the operation
     virtual uix_result update(bool full = true) override {
+        // with update(false) the app runs between tiles, so the frame's wall
+        // time can't be attributed to painting and flushing
+        if (!m_rendering) {
+            m_frame_timed = full;
+        } else if (!full) {
+            m_frame_timed = false;
+        }
         uix_result res = update_impl();
         if (res != uix_result::success) {
             return res;
@@ -1177,7 +2088,9 @@ class screen_ex final : public screen_base {
     /// @brief Indicates if the screen has any dirty regions to update and flush
     /// @return True if the screen needs updating, otherwise false
     virtual bool dirty() const override {
-        return this->m_dirty_rects.size() != 0;
+        return this->m_dirty_rects.size() != 0 ||
+               this->m_next_dirty.size() != 0 || this->m_cells_dirty ||
+               this->m_controls_invalid;
     }
 };
 /// @brief A convenience wrapper for screen_ex<> that is simpler to use
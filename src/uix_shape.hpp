@@ -0,0 +1,262 @@
+#ifndef HTCW_UIX_SHAPE_HPP
+#define HTCW_UIX_SHAPE_HPP
+#include <math.h>
+#include <htcw_data.hpp>
+#include "uix_core.hpp"
+namespace uix {
+/// @brief An anti-aliased, axis aligned rounded rectangle, ellipse or border ring, stored as per-row coverage runs.
+/// Painting is integer span fills only, so it is much cheaper than going through the vector canvas.
+class rounded_shape final {
+    // sub-scanlines per pixel row when computing coverage
+    constexpr static const int sub_rows = 16;
+    struct run {
+        int16_t x;
+        uint16_t length;
+        uint8_t coverage;
+    };
+    struct row {
+        uint32_t first;
+        uint16_t count;
+    };
+    using runs_type = data::simple_vector<run>;
+    using rows_type = data::simple_vector<row>;
+    runs_type m_runs;
+    rows_type m_rows;
+    srect16 m_bounds;
+    void* (*m_allocator)(size_t);
+    void (*m_deallocator)(void*);
+    rounded_shape(const rounded_shape& rhs) = delete;
+    rounded_shape& operator=(const rounded_shape& rhs) = delete;
+    static sizef clamp_radiuses(const rectf& rect, sizef radiuses) {
+        const float hw = (rect.x2 - rect.x1) * .5f, hh = (rect.y2 - rect.y1) * .5f;
+        if (radiuses.width > hw) radiuses.width = hw;
+        if (radiuses.height > hh) radiuses.height = hh;
+        if (radiuses.width < 0.f) radiuses.width = 0.f;
+        if (radiuses.height < 0.f) radiuses.height = 0.f;
+        return radiuses;
+    }
+    // the horizontal extent of the shape along a scanline
+    static bool span_at(float y, const rectf& rect, sizef radiuses, float* out_left, float* out_right) {
+        if (y < rect.y1 || y > rect.y2 || rect.x2 <= rect.x1) {
+            return false;
+        }
+        float dx = 0.f;
+        if (radiuses.width > 0.f && radiuses.height > 0.f) {
+            float t = -1.f;
+            if (y < rect.y1 + radiuses.height) {
+                t = (rect.y1 + radiuses.height - y) / radiuses.height;
+            } else if (y > rect.y2 - radiuses.height) {
+                t = (y - (rect.y2 - radiuses.height)) / radiuses.height;
+            }
+            if (t > 0.f) {
+                const float s = 1.f - t * t;
+                dx = radiuses.width * (1.f - (s > 0.f ? sqrtf(s) : 0.f));
+            }
+        }
+        *out_left = rect.x1 + dx;
+        *out_right = rect.x2 - dx;
+        return *out_left < *out_right;
+    }
+    static void accumulate(float* acc, int16_t origin, int16_t width, float left, float right, float weight) {
+        int16_t i = (int16_t)floorf(left);
+        const int16_t end = (int16_t)ceilf(right);
+        for (; i < end; ++i) {
+            const int16_t j = i - origin;
+            if (j < 0 || j >= width) continue;
+            const float a = left > i ? left : i;
+            const float b = right < i + 1 ? right : i + 1;
+            if (b > a) acc[j] += (b - a) * weight;
+        }
+    }
+    bool same_as_last(uint32_t first, uint16_t count) const {
+        if (m_rows.size() == 0) {
+            return false;
+        }
+        const row& last = m_rows.cbegin()[m_rows.size() - 1];
+        if (last.count != count) {
+            return false;
+        }
+        const run* a = m_runs.cbegin() + last.first;
+        const run* b = m_runs.cbegin() + first;
+        for (uint16_t i = 0; i < count; ++i) {
+            if (a[i].x != b[i].x || a[i].length != b[i].length || a[i].coverage != b[i].coverage) {
+                return false;
+            }
+        }
+        return true;
+    }
+    uix_result build(const rectf& outer, sizef outer_radiuses, const rectf* inner, sizef inner_radiuses) {
+        clear();
+        outer_radiuses = clamp_radiuses(outer, outer_radiuses);
+        if (inner != nullptr) {
+            inner_radiuses = clamp_radiuses(*inner, inner_radiuses);
+        }
+        m_bounds = srect16((int16_t)floorf(outer.x1), (int16_t)floorf(outer.y1), (int16_t)ceilf(outer.x2) - 1, (int16_t)ceilf(outer.y2) - 1);
+        const int16_t w = m_bounds.width();
+        if (w <= 0 || m_bounds.y2 < m_bounds.y1) {
+            clear();
+            return uix_result::invalid_argument;
+        }
+        float* acc = (float*)m_allocator(w * sizeof(float));
+        if (acc == nullptr) {
+            clear();
+            return uix_result::out_of_memory;
+        }
+        constexpr static const float weight = 1.f / sub_rows;
+        for (int16_t y = m_bounds.y1; y <= m_bounds.y2; ++y) {
+            memset(acc, 0, w * sizeof(float));
+            for (int s = 0; s < sub_rows; ++s) {
+                const float sy = y + (s + .5f) * weight;
+                float l, r;
+                if (span_at(sy, outer, outer_radiuses, &l, &r)) {
+                    accumulate(acc, m_bounds.x1, w, l, r, weight);
+                    if (inner != nullptr && span_at(sy, *inner, inner_radiuses, &l, &r)) {
+                        accumulate(acc, m_bounds.x1, w, l, r, -weight);
+                    }
+                }
+            }
+            // merge equal neighbors into runs
+            const uint32_t first = m_runs.size();
+            uint16_t count = 0;
+            for (int16_t x = 0; x < w;) {
+                float a = acc[x] * 255.f + .5f;
+                const uint8_t cov = a <= 0.f ? 0 : a >= 255.f ? 255 : (uint8_t)a;
+                int16_t x2 = x + 1;
+                while (x2 < w) {
+                    float b = acc[x2] * 255.f + .5f;
+                    const uint8_t cov2 = b <= 0.f ? 0 : b >= 255.f ? 255 : (uint8_t)b;
+                    if (cov2 != cov) break;
+                    ++x2;
+                }
+                if (cov != 0) {
+                    if (!m_runs.push_back({x, (uint16_t)(x2 - x), cov})) {
+                        m_deallocator(acc);
+                        clear();
+                        return uix_result::out_of_memory;
+                    }
+                    ++count;
+                }
+                x = x2;
+            }
+            row rw;
+            if (same_as_last(first, count)) {
+                // share the runs of the previous row
+                if (count != 0) {
+                    m_runs.erase(m_runs.begin() + first, m_runs.end() - 1);
+                }
+                rw = m_rows.cbegin()[m_rows.size() - 1];
+            } else {
+                rw = {first, count};
+            }
+            if (!m_rows.push_back(rw)) {
+                m_deallocator(acc);
+                clear();
+                return uix_result::out_of_memory;
+            }
+        }
+        m_deallocator(acc);
+        return uix_result::success;
+    }
+
+   public:
+    /// @brief Constructs an empty shape
+    /// @param allocator The allocator for the coverage tables
+    /// @param reallocator The reallocator for the coverage tables
+    /// @param deallocator The deallocator for the coverage tables
+    rounded_shape(void*(allocator)(size_t) = ::malloc, void*(reallocator)(void*, size_t) = ::realloc, void(deallocator)(void*) = ::free) : m_runs(allocator, reallocator, deallocator), m_rows(allocator, reallocator, deallocator), m_bounds(0, 0, -1, -1), m_allocator(allocator), m_deallocator(deallocator) {
+    }
+    /// @brief Moves a shape
+    /// @param rhs The shape to move
+    rounded_shape(rounded_shape&& rhs) : m_runs(helpers::uix_move(rhs.m_runs)), m_rows(helpers::uix_move(rhs.m_rows)), m_bounds(rhs.m_bounds), m_allocator(rhs.m_allocator), m_deallocator(rhs.m_deallocator) {
+        rhs.m_bounds = srect16(0, 0, -1, -1);
+    }
+    /// @brief Moves a shape
+    /// @param rhs The shape to move
+    /// @return this
+    rounded_shape& operator=(rounded_shape&& rhs) {
+        m_runs = helpers::uix_move(rhs.m_runs);
+        m_rows = helpers::uix_move(rhs.m_rows);
+        m_bounds = rhs.m_bounds;
+        rhs.m_bounds = srect16(0, 0, -1, -1);
+        m_allocator = rhs.m_allocator;
+        m_deallocator = rhs.m_deallocator;
+        return *this;
+    }
+    /// @brief Indicates whether the shape has been built
+    /// @return True if the shape can be painted, otherwise false
+    bool valid() const {
+        return m_rows.size() != 0;
+    }
+    /// @brief Indicates the pixels touched by the shape, relative to the paint location
+    /// @return The bounding rectangle
+    srect16 bounds() const {
+        return m_bounds;
+    }
+    /// @brief Releases the coverage tables
+    void clear() {
+        m_runs.clear();
+        m_rows.clear();
+        m_bounds = srect16(0, 0, -1, -1);
+    }
+    /// @brief Builds a filled rounded rectangle. An ellipse is a rectangle whose radiuses are half its size.
+    /// @param rect The rectangle, in the same coordinates the vector canvas uses
+    /// @param radiuses The corner radiuses
+    /// @return The result of the operation
+    uix_result fill(const rectf& rect, sizef radiuses) {
+        return build(rect, radiuses, nullptr, {0.f, 0.f});
+    }
+    /// @brief Builds the border of a rounded rectangle, as the vector canvas would stroke it
+    /// @param rect The rectangle, in the same coordinates the vector canvas uses
+    /// @param radiuses The corner radiuses
+    /// @param width The stroke width, centered on the edge
+    /// @return The result of the operation
+    uix_result stroke(const rectf& rect, sizef radiuses, float width) {
+        const float h = width * .5f;
+        const rectf outer(rect.x1 - h, rect.y1 - h, rect.x2 + h, rect.y2 + h);
+        const rectf inner(rect.x1 + h, rect.y1 + h, rect.x2 - h, rect.y2 - h);
+        const sizef orad = (radiuses.width > 0.f && radiuses.height > 0.f) ? sizef(radiuses.width + h, radiuses.height + h) : sizef(0.f, 0.f);
+        return build(outer, orad, &inner, {radiuses.width - h, radiuses.height - h});
+    }
+    /// @brief Paints the shape
+    /// @tparam Destination The type of the draw destination
+    /// @tparam Color The type of the color
+    /// @param destination The destination to draw to
+    /// @param location The offset to apply to the shape
+    /// @param color The color. Translucent colors are supported.
+    /// @param clip The clipping rectangle
+    template <typename Destination, typename Color>
+    void paint(Destination& destination, spoint16 location, Color color, const srect16& clip) const {
+        if (!valid()) {
+            return;
+        }
+        gfx::rgba_pixel<32> px;
+        convert(color, &px);
+        const uint8_t alpha = px.template channel<gfx::channel_name::A>();
+        if (alpha == 0) {
+            return;
+        }
+        const srect16 b = m_bounds.offset(location.x, location.y);
+        if (!b.intersects(clip)) {
+            return;
+        }
+        const srect16 c = b.crop(clip);
+        for (int16_t y = c.y1; y <= c.y2; ++y) {
+            const row& rw = m_rows.cbegin()[y - b.y1];
+            const run* it = m_runs.cbegin() + rw.first;
+            for (uint16_t i = 0; i < rw.count; ++i, ++it) {
+                int16_t x1 = b.x1 + it->x;
+                int16_t x2 = x1 + it->length - 1;
+                if (x1 < c.x1) x1 = c.x1;
+                if (x2 > c.x2) x2 = c.x2;
+                if (x2 < x1) continue;
+                gfx::rgba_pixel<32> p = px;
+                if (it->coverage != 255 || alpha != 255) {
+                    p.template channel<gfx::channel_name::A>((uint8_t)((it->coverage * alpha + 127) / 255));
+                }
+                gfx::draw::filled_rectangle(destination, srect16(x1, y, x2, y), p);
+            }
+        }
+    }
+};
+}  // namespace uix
+#endif  // HTCW_UIX_SHAPE_HPP
@@ -0,0 +1,229 @@
+#ifndef HTCW_UIX_TEXT_LAYOUT_HPP
+#define HTCW_UIX_TEXT_LAYOUT_HPP
+#include <string.h>
+#include "uix_core.hpp"
+namespace uix {
+/// @brief The measured extents and line breaks of a run of text
+struct text_layout final {
+    /// @brief The most lines a layout holds. Longer text has no line table.
+    constexpr static const size_t max_lines = 16;
+    /// @brief One line of laid out text, relative to the top left of the text
+    struct line {
+        /// @brief The offset of the line's first byte in the text
+        uint16_t offset;
+        /// @brief The number of bytes in the line, excluding the line break
+        uint16_t byte_count;
+        /// @brief The top of the line
+        int16_t y1;
+        /// @brief The bottom of the line
+        int16_t y2;
+        /// @brief The right edge of the line, or -1 if it is empty
+        int16_t x2;
+    };
+    /// @brief The size of the whole text
+    size16 size;
+    /// @brief The lines, if lines_size is not zero
+    line lines[max_lines];
+    /// @brief The number of lines, or zero if the text must be drawn as a whole
+    uint8_t lines_size;
+    /// @brief Measures text and splits it into lines
+    /// @param info The text to lay out
+    void compute(const gfx::text_info& info) {
+        info.text_font->measure(uint16_t(-1), info, &size);
+        lines_size = 0;
+        // line breaks can only be found by byte in ASCII compatible encodings
+        if ((info.encoding != &gfx::text_encoding::utf8 && info.encoding != &gfx::text_encoding::latin1) ||
+            info.text_byte_count > 0xFFFF) {
+            return;
+        }
+        const char* sz = (const char*)info.text;
+        const int16_t lh = info.text_font->line_height();
+        gfx::text_info li = info;
+        size_t start = 0;
+        for (size_t i = 0; i <= info.text_byte_count; ++i) {
+            if (i < info.text_byte_count && sz[i] != '\n') {
+                continue;
+            }
+            if (lines_size == max_lines) {
+                lines_size = 0;
+                return;
+            }
+            line& l = lines[lines_size];
+            l.offset = (uint16_t)start;
+            l.byte_count = (uint16_t)(i - start);
+            l.y1 = (int16_t)(lines_size * lh);
+            l.y2 = l.y1 + lh - 1;
+            l.x2 = -1;
+            if (l.byte_count != 0) {
+                size16 lsz;
+                li.text = sz + start;
+                li.text_byte_count = l.byte_count;
+                info.text_font->measure(uint16_t(-1), li, &lsz);
+                l.x2 = lsz.width - 1;
+            }
+            ++lines_size;
+            start = i + 1;
+        }
+    }
+};
+/// @brief Keeps the layouts of recently measured text, keyed by content, so text that is shown again isn't measured again
+class text_layout_cache final {
+   public:
+    /// @brief The number of layouts the cache holds
+    constexpr static const size_t max_capacity = 8;
+
+   private:
+    struct entry {
+        uint32_t hash;
+        // a copy of the text, since the caller's buffer may be freed or rewritten in place
+        uint8_t* text;
+        size_t text_capacity;
+        size_t byte_count;
+        const gfx::font* font;
+        const gfx::text_encoder* encoding;
+        uint16_t line_height;
+        uint16_t tab_width;
+        uint32_t age;
+        uint32_t stamp;
+        text_layout layout;
+    };
+    entry m_entries[max_capacity];
+    uint32_t m_age;
+    uint32_t m_stamp;
+    void*(*m_reallocator)(void*, size_t);
+    void(*m_deallocator)(void*);
+    text_layout_cache(const text_layout_cache& rhs) = delete;
+    text_layout_cache& operator=(const text_layout_cache& rhs) = delete;
+    text_layout_cache(text_layout_cache&& rhs) = delete;
+    text_layout_cache& operator=(text_layout_cache&& rhs) = delete;
+    static uint32_t hash(const gfx::text_info& info) {
+        // FNV-1a
+        uint32_t result = 2166136261u;
+        const uint8_t* p = (const uint8_t*)info.text;
+        for (size_t i = 0; i < info.text_byte_count; ++i) {
+            result = (result ^ p[i]) * 16777619u;
+        }
+        return result;
+    }
+    entry* find(const gfx::text_info& info, uint32_t h) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            entry& e = m_entries[i];
+            // the bytes are compared too, so a hash collision can't return another string's layout
+            if (e.font == info.text_font && e.hash == h && e.byte_count == info.text_byte_count &&
+                e.encoding == info.encoding && e.tab_width == info.tab_width &&
+                e.line_height == info.text_font->line_height() &&
+                0 == memcmp(e.text, info.text, info.text_byte_count)) {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+    static void forget(entry& e) {
+        e.font = nullptr;
+        e.age = 0;
+        e.stamp = 0;
+    }
+
+   public:
+    /// @brief Constructs a new cache
+    /// @param reallocator The reallocator for the copies of the text
+    /// @param deallocator The deallocator for the copies of the text
+    text_layout_cache(void*(reallocator)(void*, size_t) = ::realloc, void(deallocator)(void*) = ::free) : m_age(0), m_stamp(0), m_reallocator(reallocator), m_deallocator(deallocator) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            m_entries[i].text = nullptr;
+            m_entries[i].text_capacity = 0;
+            forget(m_entries[i]);
+        }
+    }
+    /// @brief Destroys the cache
+    ~text_layout_cache() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (m_entries[i].text != nullptr) {
+                m_deallocator(m_entries[i].text);
+            }
+        }
+    }
+    /// @brief Retrieves the layout of text, measuring it if it is not in the cache
+    /// @param info The text, which must have a font and encoding
+    /// @param out_stamp Receives a value that identifies this layout to valid()
+    /// @return The layout, which stays in the cache until valid() reports otherwise
+    const text_layout* layout(const gfx::text_info& info, uint32_t* out_stamp) {
+        const uint32_t h = hash(info);
+        entry* e = find(info, h);
+        if (e == nullptr) {
+            e = &m_entries[0];
+            for (size_t i = 1; i < max_capacity; ++i) {
+                if (m_entries[i].age < e->age) {
+                    e = &m_entries[i];
+                }
+            }
+            forget(*e);
+            e->layout.compute(info);
+            e->stamp = ++m_stamp;
+            if (e->text_capacity < info.text_byte_count) {
+                uint8_t* text = (uint8_t*)m_reallocator(e->text, info.text_byte_count);
+                if (text == nullptr) {
+                    // the layout can still be used, but it can't be found again
+                    *out_stamp = e->stamp;
+                    return &e->layout;
+                }
+                e->text = text;
+                e->text_capacity = info.text_byte_count;
+            }
+            if (info.text_byte_count != 0) {
+                memcpy(e->text, info.text, info.text_byte_count);
+            }
+            e->hash = h;
+            e->byte_count = info.text_byte_count;
+            e->encoding = info.encoding;
+            e->tab_width = info.tab_width;
+            e->line_height = info.text_font->line_height();
+            e->font = info.text_font;
+        }
+        e->age = ++m_age;
+        *out_stamp = e->stamp;
+        return &e->layout;
+    }
+    /// @brief Indicates whether a layout returned by layout() is still held, so it need not be looked up again
+    /// @param layout The layout
+    /// @param stamp The stamp layout() returned with it
+    /// @return True if the layout is unchanged, or false if it has been evicted or forgotten
+    bool valid(const text_layout* layout, uint32_t stamp) const {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (&m_entries[i].layout == layout) {
+                return stamp != 0 && m_entries[i].stamp == stamp;
+            }
+        }
+        return false;
+    }
+    /// @brief Forgets the layouts measured with a font, such as before the font is destroyed or its size changes
+    /// @param font The font
+    void remove(const gfx::font& font) {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            if (m_entries[i].font == &font) {
+                forget(m_entries[i]);
+            }
+        }
+    }
+    /// @brief Forgets all layouts
+    void clear() {
+        for (size_t i = 0; i < max_capacity; ++i) {
+            forget(m_entries[i]);
+        }
+    }
+};
+namespace helpers {
+template <bool Dummy>
+struct text_layout_cache_shared {
+    static text_layout_cache cache;
+};
+template <bool Dummy>
+text_layout_cache text_layout_cache_shared<Dummy>::cache;
+}  // namespace helpers
+/// @brief Retrieves the layout cache labels share
+/// @return The shared cache
+inline text_layout_cache& default_text_layout_cache() {
+    return helpers::text_layout_cache_shared<true>::cache;
+}
+}  // namespace uix
+#endif  // HTCW_UIX_TEXT_LAYOUT_HPP
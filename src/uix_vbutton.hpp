@@ -1,6 +1,8 @@
 #ifndef HTCW_UIX_VBUTTON_HPP
 #define HTCW_UIX_VBUTTON_HPP
 #include "uix_canvas_control.hpp"
+#include "uix_nine_slice.hpp"
+#include "uix_shape.hpp"
 namespace uix {
 template <typename ControlSurfaceType>
 class vbutton : public canvas_control<ControlSurfaceType> {
@@ -25,6 +27,13 @@ class vbutton : public canvas_control<ControlSurfaceType> {
     on_pressed_changed_callback_type m_on_pressed_changed_callback;
     void* m_on_pressed_changed_callback_state;
     bool m_pressed;
+    bool m_skinned;
+    nine_slice_atlas* m_atlas;
+    const nine_slice_skin* m_skin;
+    rounded_shape m_frame_fill, m_frame_border;
+    float m_frame_stroke;
+    bool m_frame_dirty;
+    bool m_frame_painted;
     bool is_valid() {
         return m_text_info.text != nullptr && m_text_info.font_size != 0 && m_text_info.ttf_font != nullptr && m_text_info.encoding != nullptr && m_text_info.text_byte_count != 0;
     }
@@ -74,6 +83,35 @@ class vbutton : public canvas_control<ControlSurfaceType> {
                 return {0.f, 0.f};
         }
     }
+    bool has_border() const {
+        return m_border_color != m_background_color && m_border_color.opacity() != 0;
+    }
+    void release_skin() {
+        if (m_skin != nullptr) {
+            m_atlas->release(m_skin);
+            m_skin = nullptr;
+        }
+    }
+    float frame_stroke() const {
+        return has_border() ? m_border_width * 0.5f : 0.f;
+    }
+    void build_frame() {
+        m_frame_dirty = false;
+        m_frame_stroke = frame_stroke();
+        m_frame_fill.clear();
+        m_frame_border.clear();
+        gfx::rectf rf = (rectf)this->dimensions().bounds();
+        rf.inflate_inplace(-2, -2);
+        if (uix_result::success != m_frame_fill.fill(rf, (sizef)m_radiuses) ||
+            (m_frame_stroke > 0.f && uix_result::success != m_frame_border.stroke(rf, (sizef)m_radiuses, m_frame_stroke))) {
+            m_frame_fill.clear();
+            m_frame_border.clear();
+        }
+    }
+    bool use_skin() const {
+        return m_skin != nullptr && m_skin->fits((size16)this->dimensions()) &&
+               coverage_mask::paintable(m_background_color) && (!has_border() || coverage_mask::paintable(m_border_color));
+    }
 
    protected:
     void do_move_control(vbutton& rhs) {
@@ -92,6 +130,15 @@ class vbutton : public canvas_control<ControlSurfaceType> {
         m_on_pressed_changed_callback_state = rhs.m_on_pressed_changed_callback_state;
         m_pressed = rhs.m_pressed;
         rhs.m_pressed = false;
+        release_skin();
+        m_skinned = rhs.m_skinned;
+        m_atlas = rhs.m_atlas;
+        m_skin = rhs.m_skin;
+        rhs.m_skin = nullptr;
+        m_frame_fill = helpers::uix_move(rhs.m_frame_fill);
+        m_frame_border = helpers::uix_move(rhs.m_frame_border);
+        m_frame_stroke = rhs.m_frame_stroke;
+        m_frame_dirty = rhs.m_frame_dirty;
     }
     void do_copy_control(const vbutton& rhs) {
         this->base_type::do_copy_control(rhs);
@@ -107,9 +154,61 @@ class vbutton : public canvas_control<ControlSurfaceType> {
         m_on_pressed_changed_callback = rhs.m_on_pressed_changed_callback;
         m_on_pressed_changed_callback_state = rhs.m_on_pressed_changed_callback_state;
         m_pressed = rhs.m_pressed;
+        release_skin();
+        m_skinned = rhs.m_skinned;
+        m_atlas = rhs.m_atlas;
+        m_frame_dirty = true;
+    }
+    /// @brief Called before the control is rendered
+    virtual void on_before_paint() override {
+        const float bw = frame_stroke();
+        if (!m_skinned) {
+            release_skin();
+        } else if (m_skin == nullptr || !m_skin->matches(m_radiuses, 2, bw)) {
+            release_skin();
+            m_skin = m_atlas->acquire(m_radiuses, 2, bw);
+        }
+        if (use_skin()) {
+            // the frame shapes aren't needed
+            m_frame_fill.clear();
+            m_frame_border.clear();
+            m_frame_dirty = true;
+        } else if (m_frame_dirty || m_frame_stroke != bw) {
+            build_frame();
+        }
+    }
+    /// @brief Called when the control is resized
+    virtual void on_after_resize() override {
+        m_frame_dirty = true;
+    }
+    /// @brief Called to paint the control
+    /// @param destination The destination to draw to
+    /// @param clip The clipping rectangle
+    virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
+        m_frame_painted = false;
+        if (use_skin()) {
+            srect16 b = this->dimensions().bounds();
+            if (m_pressed) {
+                b.offset_inplace(1, 1);
+            }
+            m_skin->paint(destination, b, m_background_color, m_border_color, clip);
+            m_frame_painted = true;
+        } else if (m_frame_fill.valid()) {
+            const spoint16 pt(m_pressed, m_pressed);
+            m_frame_fill.paint(destination, pt, m_background_color, clip);
+            if (m_frame_stroke > 0.f) {
+                m_frame_border.paint(destination, pt, m_border_color, clip);
+            }
+            m_frame_painted = true;
+        }
+        if (m_frame_painted && !is_valid()) {
+            return;
+        }
+        // the canvas draws the text, and the frame when it isn't skinned
+        base_type::on_paint(destination, clip);
     }
     virtual void on_paint(gfx::canvas& destination, const srect16& clip) override {
-        const bool has_border = m_border_color != m_background_color && m_border_color.opacity() != 0;
+        const bool has_border = this->has_border();
         gfx::canvas_style st = destination.style();
         st.fill_rule = gfx::fill_rule::non_zero;
         if (has_border) {
@@ -122,14 +221,16 @@ class vbutton : public canvas_control<ControlSurfaceType> {
         st.fill_color = m_background_color;
         st.fill_paint_type = gfx::paint_type::solid;
         destination.style(st);
-        gfx::rectf rf = (rectf)destination.bounds();
+        gfx::rectf rf = (rectf)this->dimensions().bounds();
         rf.inflate_inplace(-2, -2);
         if (m_pressed) {
             rf.offset_inplace(1, 1);
         }
-        gfx::sizef szf = (sizef)m_radiuses;
-        destination.rounded_rectangle(rf, szf);
-        destination.render();
+        if (!m_frame_painted) {
+            gfx::sizef szf = (sizef)m_radiuses;
+            destination.rounded_rectangle(rf, szf);
+            destination.render();
+        }
         gfx::canvas_text_info cti;
         if (is_valid()) {
             destination.stroke_paint_type(gfx::paint_type::none);
@@ -171,7 +272,7 @@ class vbutton : public canvas_control<ControlSurfaceType> {
 
    public:
     /// @brief Constructs an empty control instance
-    vbutton() : base_type(), m_padding({4, 4}), m_text_justify(uix_justify::center), m_text_loc(-1, -1), m_on_pressed_changed_callback(nullptr), m_pressed(false) {
+    vbutton() : base_type(), m_padding({4, 4}), m_text_justify(uix_justify::center), m_text_loc(-1, -1), m_on_pressed_changed_callback(nullptr), m_pressed(false), m_skinned(true), m_atlas(&default_nine_slice_atlas()), m_skin(nullptr), m_frame_stroke(0.f), m_frame_dirty(true), m_frame_painted(false) {
         constexpr static const auto black = gfx::rgba_pixel<32>(0xFF, 0xFF, 0xFF, 0xFF);
         constexpr static const auto gray = gfx::rgba_pixel<32>(0x7F, 0x7F, 0x7F, 0xFF);
         color(black);
@@ -185,7 +286,7 @@ class vbutton : public canvas_control<ControlSurfaceType> {
     /// @brief Constructs a control given a parent and an optional palette
     /// @param parent The parent invalidation tracker - usually a screen
     /// @param palette The palette. Typically the screen's palette()
-    vbutton(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_padding({4, 4}), m_text_justify(uix_justify::center), m_text_loc(-1, -1), m_on_pressed_changed_callback(nullptr), m_pressed(false) {
+    vbutton(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_padding({4, 4}), m_text_justify(uix_justify::center), m_text_loc(-1, -1), m_on_pressed_changed_callback(nullptr), m_pressed(false), m_skinned(true), m_atlas(&default_nine_slice_atlas()), m_skin(nullptr), m_frame_stroke(0.f), m_frame_dirty(true), m_frame_painted(false) {
         constexpr static const auto black = gfx::rgba_pixel<32>(0xFF, 0xFF, 0xFF, 0xFF);
         constexpr static const auto gray = gfx::rgba_pixel<32>(0x7F, 0x7F, 0x7F, 0xFF);
         color(black);
@@ -196,6 +297,37 @@ class vbutton : public canvas_control<ControlSurfaceType> {
         m_text_info.ttf_font = nullptr;
         m_text_info.encoding = &gfx::text_encoding::utf8;
     }
+    /// @brief Destroys the button
+    virtual ~vbutton() {
+        release_skin();
+    }
+    /// @brief Indicates whether the button frame is composed from a shared pre-rendered skin rather than rasterized on each paint
+    /// @return True if skinned, otherwise false
+    bool skinned() const {
+        return m_skinned;
+    }
+    /// @brief Sets whether the button frame is composed from a shared pre-rendered skin rather than rasterized on each paint
+    /// @param value True to use a skin, otherwise false
+    void skinned(bool value) {
+        if (m_skinned != value) {
+            m_skinned = value;
+            this->invalidate();
+        }
+    }
+    /// @brief Indicates the atlas the button borrows its skin from
+    /// @return The atlas
+    nine_slice_atlas& atlas() const {
+        return *m_atlas;
+    }
+    /// @brief Sets the atlas the button borrows its skin from
+    /// @param value The atlas
+    void atlas(nine_slice_atlas& value) {
+        if (m_atlas != &value) {
+            release_skin();
+            m_atlas = &value;
+            this->invalidate();
+        }
+    }
     /// @brief Indicates whether or not the button is pressed
     /// @return True if pressed, otherwise false
     bool pressed() const {
@@ -337,6 +469,7 @@ class vbutton : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void border_width(uint16_t value) {
         m_border_width = value;
+        m_frame_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the radiuses of the button edge
@@ -348,6 +481,7 @@ class vbutton : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void radiuses(size16 value) {
         m_radiuses = value;
+        m_frame_dirty = true;
         this->invalidate();
     }
     /// @brief Retrieves the pressed changed callback
@@ -1,6 +1,8 @@
 #ifndef HTCW_UIX_VLABEL_HPP
 #define HTCW_UIX_VLABEL_HPP
 #include "uix_canvas_control.hpp"
+#include "uix_mask.hpp"
+#include "uix_shape.hpp"
 namespace uix {
 
 /// @brief A vector label for displaying text
@@ -25,6 +27,45 @@ private:
     gfx::sizef m_radiuses;
     float m_border_width;
     gfx::rgba_pixel<32> m_border_color;
+    // cached layers, rebuilt when the text or geometry changes
+    coverage_mask m_text_mask;
+    rounded_shape m_background_shape, m_border_shape;
+    bool m_masks_dirty;
+    bool rounded() const {
+        return m_radiuses.width!=0.f || m_radiuses.height!=0.f;
+    }
+    static void render_text(gfx::canvas& dst, void* state) {
+        vlabel* t = (vlabel*)state;
+        coverage_mask::ink_style(dst, true);
+        dst.transform(t->m_matrix);
+        dst.path(t->m_label_text_path);
+        dst.render();
+    }
+    void build_masks() {
+        m_masks_dirty = false;
+        m_text_mask.clear();
+        m_background_shape.clear();
+        m_border_shape.clear();
+        if(m_font_stream==nullptr || !m_label_text_path.initialized()) {
+            return;
+        }
+        const gfx::size16 dim = (gfx::size16)this->dimensions();
+        if(uix_result::success!=m_text_mask.render(dim,render_text,this,this->pool())) {
+            return;
+        }
+        if(rounded()) {
+            const gfx::rectf b = (gfx::rectf)this->dimensions().bounds();
+            if(uix_result::success!=m_background_shape.fill(b,m_radiuses) ||
+                (m_border_width>0 && uix_result::success!=m_border_shape.stroke(b,m_radiuses,m_border_width))) {
+                m_text_mask.clear();
+                m_background_shape.clear();
+                m_border_shape.clear();
+            }
+        }
+    }
+    bool use_masks() const {
+        return m_text_mask.valid() && coverage_mask::paintable(m_color);
+    }
    
     void build_label_path_untransformed() {
         if(m_font_stream==nullptr) {
@@ -119,7 +160,7 @@ private:
         
     }
 public:
-    vlabel() : base_type() ,m_label_text_dirty(true) {
+    vlabel() : base_type() ,m_label_text_dirty(true), m_masks_dirty(true) {
         m_font_stream = nullptr;
         m_border_width = 0;
         
@@ -196,6 +237,7 @@ public:
     }
     void radiuses(gfx::sizef value) {
         m_radiuses=value;
+        m_masks_dirty = true;
         this->invalidate();
     }
     gfx::rgba_pixel<32> border_color() const {
@@ -216,10 +258,17 @@ public:
         }
     }
 protected:
+    virtual void on_after_resize() override {
+        m_label_text_dirty = true;
+    }
     virtual void on_before_paint() override {
         if(m_label_text_dirty) {
             build_label_path_untransformed();
             m_label_text_dirty = false;
+            m_masks_dirty = true;
+        }
+        if(m_masks_dirty) {
+            build_masks();
         }
     }
     virtual void on_paint(control_surface_type& destination, const gfx::srect16& clip) {
@@ -234,7 +283,19 @@ protected:
                 
             }
         }
-        base_type::on_paint(destination,clip);
+        if(m_font_stream==nullptr) {
+            return;
+        }
+        if(!use_masks()) {
+            // rasterize through the canvas
+            base_type::on_paint(destination,clip);
+            return;
+        }
+        if(m_background_color.opacity()!=0 && rounded()) {
+            m_background_shape.paint(destination,gfx::spoint16::zero(),m_background_color,clip);
+            m_border_shape.paint(destination,gfx::spoint16::zero(),m_border_color,clip);
+        }
+        m_text_mask.paint(destination,gfx::spoint16::zero(),m_color,&clip);
     }
     virtual void on_paint(gfx::canvas& destination, const gfx::srect16& clip) override {
         if(m_font_stream==nullptr) {
@@ -255,7 +316,7 @@ protected:
                 }
                 convert(m_background_color,&si.fill_color);
                 destination.style(si);
-                destination.rounded_rectangle((gfx::rectf)destination.bounds(),m_radiuses);
+                destination.rounded_rectangle((gfx::rectf)this->dimensions().bounds(),m_radiuses);
                 destination.render();
             }
         }
@@ -2,6 +2,7 @@
 #define HTCW_UIX_VSLIDER
 #include "uix_canvas_control.hpp"
 #include "uix_core.hpp"
+#include "uix_shape.hpp"
 namespace uix {
 /// @brief The shape of the slider knob
 enum struct vslider_shape {
@@ -39,6 +40,10 @@ class vslider : public canvas_control<ControlSurfaceType> {
     void* m_on_value_changed_state;
     on_released_callback_type m_on_released_cb;
     void* m_on_released_state;
+    // cached coverage, rebuilt when the geometry changes
+    rounded_shape m_bar_fill, m_bar_border;
+    rounded_shape m_knob_fill, m_knob_border;
+    bool m_shapes_dirty;
     void do_copy_fields(const vslider& rhs) {
         m_knob_color = rhs.m_knob_color;
         m_knob_border_color = rhs.m_knob_border_color;
@@ -58,6 +63,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
         m_on_value_changed_state = rhs.m_on_value_changed_state;
         m_on_released_cb = rhs.m_on_released_cb;
         m_on_released_state = rhs.m_on_released_state;
+        m_shapes_dirty = true;
     }
     void validate_values() {
         if (m_maximum < m_minimum) {
@@ -66,12 +72,16 @@ class vslider : public canvas_control<ControlSurfaceType> {
             m_minimum = tmp;
         }
     }
-    void draw_knob(gfx::canvas& dst, uint16_t value) {
-        float radius;
+    float knob_radius() const {
         if (m_orientation == uix_orientation::horizontal) {
-            radius = this->dimensions().height * 0.5f;
-        } else {
-            radius = this->dimensions().width * 0.5f;
+            return this->dimensions().height * 0.5f;
+        }
+        return this->dimensions().width * 0.5f;
+    }
+    pointf knob_center(uint16_t value) const {
+        const float radius = knob_radius();
+        if (m_knob_shape == vslider_shape::ellipse && (m_knob_radiuses.width != 0 || m_knob_radiuses.height != 0)) {
+            return pointf(radius, radius);
         }
         value += roundf(radius);
         spoint16 location;
@@ -80,18 +90,42 @@ class vslider : public canvas_control<ControlSurfaceType> {
         } else {
             location = spoint16(radius, value-radius*.5f);
         }
-        gfx::canvas_style si = dst.style();
-        si.fill_paint_type = gfx::paint_type::solid;
-        si.fill_color = m_knob_color;
-        si.stroke_width = m_knob_border_width;
-        si.stroke_paint_type = gfx::paint_type::solid;
-        si.stroke_color = m_knob_border_color;
-        dst.style(si);
+        return pointf(location.x, location.y);
+    }
+    // the knob around its center. an ellipse is a rectangle rounded by half its size
+    rectf knob_rect(pointf center, sizef* out_radiuses) const {
+        const float radius = knob_radius();
+        if (m_knob_shape == vslider_shape::ellipse) {
+            if (m_knob_radiuses.width == 0 && m_knob_radiuses.height == 0) {
+                *out_radiuses = sizef(radius - 1.0f, radius - 1.0f);
+            } else {
+                *out_radiuses = (gfx::sizef)m_knob_radiuses;
+            }
+            return rectf(center.x - out_radiuses->width, center.y - out_radiuses->height, center.x + out_radiuses->width, center.y + out_radiuses->height);
+        }
+        rectf r(center, radius - 1.f - (m_knob_border_width*.5f));
+        if (m_orientation == uix_orientation::horizontal) {
+            r.x2 = r.x1 + radius - 1.0f;
+        } else {
+            r.y2 = r.y1 + radius - 1.0f;
+        }
+        *out_radiuses = (gfx::sizef)m_knob_radiuses;
+        return r;
+    }
+    // the pixels the knob can touch at a value, including its border and anti-aliasing
+    srect16 knob_bounds(uint16_t value) const {
+        sizef radiuses;
+        const rectf r = knob_rect(knob_center(value), &radiuses);
+        const float pad = m_knob_border_width * .5f + 1.f;
+        return srect16(floorf(r.x1 - pad), floorf(r.y1 - pad), ceilf(r.x2 + pad), ceilf(r.y2 + pad));
+    }
+    void knob_path(gfx::canvas& dst, pointf center) {
+        const float radius = knob_radius();
         if (m_knob_radiuses.width == 0 && m_knob_radiuses.height == 0) {
             if (m_knob_shape == vslider_shape::ellipse) {
-                dst.ellipse(pointf(location.x, location.y), {radius - 1.0f, radius - 1.0f});
+                dst.ellipse(center, {radius - 1.0f, radius - 1.0f});
             } else if (m_knob_shape == vslider_shape::rect) {
-                rectf r(pointf(location.x, location.y), radius - 1.f - (m_knob_border_width*.5f));
+                rectf r(center, radius - 1.f - (m_knob_border_width*.5f));
                 if (m_orientation == uix_orientation::horizontal) {
                     r.x2 = r.x1 + radius - 1.0f;
                 } else {
@@ -101,9 +135,9 @@ class vslider : public canvas_control<ControlSurfaceType> {
             }
         } else {
             if (m_knob_shape == vslider_shape::ellipse) {
-                dst.ellipse({radius, radius}, (gfx::sizef)m_knob_radiuses);
+                dst.ellipse(center, (gfx::sizef)m_knob_radiuses);
             } else if (m_knob_shape == vslider_shape::rect) {
-                rectf r(pointf(location.x, location.y), radius - 1.f - (m_knob_border_width*.5f));
+                rectf r(center, radius - 1.f - (m_knob_border_width*.5f));
                 if (m_orientation == uix_orientation::horizontal) {
                     r.x2 = r.x1 + radius - 1.0f;
                 } else {
@@ -112,9 +146,19 @@ class vslider : public canvas_control<ControlSurfaceType> {
                 dst.rounded_rectangle(r, (gfx::sizef)m_knob_radiuses);
             }
         }
+    }
+    void draw_knob(gfx::canvas& dst, uint16_t value) {
+        gfx::canvas_style si = dst.style();
+        si.fill_paint_type = gfx::paint_type::solid;
+        si.fill_color = m_knob_color;
+        si.stroke_width = m_knob_border_width;
+        si.stroke_paint_type = gfx::paint_type::solid;
+        si.stroke_color = m_knob_border_color;
+        dst.style(si);
+        knob_path(dst, knob_center(value));
         dst.render();
     }
-    void draw_bar(gfx::canvas& dst) {
+    rectf bar_bounds() const {
         float radius;
         rectf bounds;
         if (m_orientation == uix_orientation::horizontal) {
@@ -139,7 +183,16 @@ class vslider : public canvas_control<ControlSurfaceType> {
 
             bounds = rectf(x1, radius, x1 + bar_total_width, this->dimensions().height - 1 - radius).offset(-1,0);
         }
-
+        return bounds;
+    }
+    void bar_path(gfx::canvas& dst, const rectf& bounds) {
+        if (m_bar_radiuses.width != 0 || m_bar_radiuses.height != 0) {
+            dst.rounded_rectangle(bounds, (gfx::sizef)m_bar_radiuses);
+        } else {
+            dst.rectangle(bounds);
+        }
+    }
+    void draw_bar(gfx::canvas& dst) {
         gfx::canvas_style si = dst.style();
         si.fill_paint_type = gfx::paint_type::solid;
         si.fill_color = m_bar_color;
@@ -147,14 +200,31 @@ class vslider : public canvas_control<ControlSurfaceType> {
         si.stroke_paint_type = gfx::paint_type::solid;
         si.stroke_color = m_bar_border_color;
         dst.style(si);
-        if (m_bar_radiuses.width != 0 || m_bar_radiuses.height != 0) {
-            dst.rounded_rectangle(bounds, (gfx::sizef)m_bar_radiuses);
-        } else {
-            dst.rectangle(bounds);
-        }
+        bar_path(dst, bar_bounds());
         dst.transform(gfx::matrix::create_identity());
         dst.render();
     }
+    void build_shapes() {
+        m_shapes_dirty = false;
+        clear_shapes();
+        const rectf bar = bar_bounds();
+        // the knob is built around the fractional part of its center, and moved by whole pixels
+        const pointf c = knob_center(m_value_internal);
+        sizef knob_radiuses;
+        const rectf knob = knob_rect(pointf(c.x - floorf(c.x), c.y - floorf(c.y)), &knob_radiuses);
+        if (uix_result::success != m_bar_fill.fill(bar, (gfx::sizef)m_bar_radiuses) ||
+            uix_result::success != m_knob_fill.fill(knob, knob_radiuses) ||
+            (m_bar_border_width > 0 && uix_result::success != m_bar_border.stroke(bar, (gfx::sizef)m_bar_radiuses, m_bar_border_width)) ||
+            (m_knob_border_width > 0 && uix_result::success != m_knob_border.stroke(knob, knob_radiuses, m_knob_border_width))) {
+            clear_shapes();
+        }
+    }
+    void clear_shapes() {
+        m_bar_fill.clear();
+        m_bar_border.clear();
+        m_knob_fill.clear();
+        m_knob_border.clear();
+    }
 
    protected:
     /// @brief For derivative classes, moves the control
@@ -200,14 +270,14 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @brief Constructs a slider from a given parent with an optional palette
     /// @param parent The parent the control is bound to - usually the screen
     /// @param palette The palette associated with the control. This is usually the screen's palette.
-    vslider(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_knob_border_width(1), m_knob_shape(vslider_shape::ellipse), m_knob_radiuses(0, 0), m_bar_border_width(1), m_bar_width(5), m_bar_radiuses(2, 2), m_minimum(0), m_maximum(100), m_value_internal(-1), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_on_released_cb(nullptr), m_on_released_state(nullptr) {
+    vslider(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_knob_border_width(1), m_knob_shape(vslider_shape::ellipse), m_knob_radiuses(0, 0), m_bar_border_width(1), m_bar_width(5), m_bar_radiuses(2, 2), m_minimum(0), m_maximum(100), m_value_internal(-1), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_on_released_cb(nullptr), m_on_released_state(nullptr), m_shapes_dirty(true) {
         m_knob_color = gfx::vector_pixel(255, 255, 255, 255);
         m_knob_border_color = gfx::vector_pixel(255, 0, 0, 0);
         m_bar_color = gfx::vector_pixel(255, 255, 255, 255);
         m_bar_border_color = gfx::vector_pixel(255, 0, 0, 0);
     }
     /// @brief Constructs a slider from a given parent with an optional palette
-    vslider() : base_type(), m_knob_border_width(1), m_knob_shape(vslider_shape::ellipse), m_knob_radiuses(0, 0), m_bar_border_width(1), m_bar_width(5), m_bar_radiuses(2, 2), m_minimum(0), m_maximum(100), m_value_internal(-1), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_on_released_cb(nullptr), m_on_released_state(nullptr) {
+    vslider() : base_type(), m_knob_border_width(1), m_knob_shape(vslider_shape::ellipse), m_knob_radiuses(0, 0), m_bar_border_width(1), m_bar_width(5), m_bar_radiuses(2, 2), m_minimum(0), m_maximum(100), m_value_internal(-1), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_on_released_cb(nullptr), m_on_released_state(nullptr), m_shapes_dirty(true) {
         m_knob_color = gfx::vector_pixel(255, 255, 255, 255);
         m_knob_border_color = gfx::vector_pixel(255, 0, 0, 0);
         m_bar_color = gfx::vector_pixel(255, 255, 255, 255);
@@ -248,6 +318,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void knob_border_width(uint16_t value) {
         m_knob_border_width = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the radiuses of the knob
@@ -259,6 +330,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The knob radiuses
     void knob_radiuses(size16 value) {
         m_knob_radiuses = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the shape of the knob
@@ -270,6 +342,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The shape
     void knob_shape(vslider_shape value) {
         m_knob_shape = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the color of the bar
@@ -307,6 +380,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void bar_border_width(uint16_t value) {
         m_bar_border_width = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the width of the bar
@@ -318,6 +392,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The bar height in pixels
     void bar_width(uint16_t value) {
         m_bar_width = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the radiuses of the bar
@@ -329,7 +404,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @param value The bar radiuses
     void bar_radiuses(size16 value) {
         m_bar_radiuses = value;
-
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the orientation of the slider
@@ -343,6 +418,7 @@ class vslider : public canvas_control<ControlSurfaceType> {
         if (m_orientation != value) {
             uint16_t v = this->value();
             m_orientation = value;
+            m_shapes_dirty = true;
             this->value(v);
         }
     }
@@ -394,11 +470,13 @@ class vslider : public canvas_control<ControlSurfaceType> {
             new_value = range_internal - new_value - 1;
         }
         if (m_value_internal != new_value) {
+            // only the knob moves, so only where it was and where it is now need redrawing
+            const srect16 old_knob = knob_bounds(m_value_internal);
             m_value_internal = new_value;
             if (m_on_value_changed_cb != nullptr) {
                 m_on_value_changed_cb(value, m_on_value_changed_state);
             }
-            this->invalidate();
+            this->invalidate(old_knob, knob_bounds(m_value_internal));
         }
     }
     /// @brief Indicates the callback for when the value changes
@@ -430,23 +508,38 @@ class vslider : public canvas_control<ControlSurfaceType> {
     /// @brief Called before the control is rendered.
     virtual void on_before_paint() override {
         validate_values();
+        if (m_shapes_dirty) {
+            build_shapes();
+        }
+    }
+    /// @brief Called when the control is resized
+    virtual void on_after_resize() override {
+        m_shapes_dirty = true;
     }
 
    protected:
+    /// @brief Called when the slider is painted
+    /// @param destination The draw destination
+    /// @param clip The clipping rectangle
+    virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
+        if (!m_bar_fill.valid() || !m_knob_fill.valid()) {
+            // rasterize through the canvas
+            base_type::on_paint(destination, clip);
+            return;
+        }
+        m_bar_fill.paint(destination, spoint16::zero(), m_bar_color, clip);
+        m_bar_border.paint(destination, spoint16::zero(), m_bar_border_color, clip);
+        const pointf c = knob_center(m_value_internal);
+        const spoint16 pt(floorf(c.x), floorf(c.y));
+        m_knob_fill.paint(destination, pt, m_knob_color, clip);
+        m_knob_border.paint(destination, pt, m_knob_border_color, clip);
+    }
     /// @brief Called when the slider is painted
     /// @param destination The draw destination
     /// @param clip The clipping rectangle
     virtual void on_paint(gfx::canvas& destination, const srect16& clip) override {
         draw_bar(destination);
-        // const float mult = 1.f / (float)range;
-        float radius;
-        if (m_orientation == uix_orientation::horizontal) {
-            radius = this->bounds().height() * 0.5f;
-        } else {
-            radius = this->bounds().width() * 0.5f;
-        }
         draw_knob(destination, m_value_internal);
-    
     }
     /// @brief Called when the slider is touched
     /// @param locations_size The count of locations (only the first one is respected)
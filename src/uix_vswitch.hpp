@@ -2,6 +2,7 @@
 #define HTCW_UIX_VSWITCH
 #include "uix_core.hpp"
 #include "uix_canvas_control.hpp"
+#include "uix_shape.hpp"
 namespace uix {
 /// @brief The shape of the switch knob
 enum struct vswitch_shape {
@@ -36,6 +37,10 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     bool m_value;
     on_value_changed_callback_type m_on_value_changed_cb;
     void* m_on_value_changed_state;
+    // cached coverage, rebuilt when the geometry changes
+    rounded_shape m_backing_fill, m_backing_border;
+    rounded_shape m_knob_fill, m_knob_border;
+    bool m_shapes_dirty;
     void do_copy_fields(const vswitch& rhs) {
         m_knob_color = rhs.m_knob_color;
         m_knob_border_color = rhs.m_knob_border_color;
@@ -50,21 +55,43 @@ class vswitch : public canvas_control<ControlSurfaceType> {
         m_value = rhs.m_value;
         m_on_value_changed_cb = rhs.m_on_value_changed_cb;
         m_on_value_changed_state = rhs.m_on_value_changed_state;
+        m_shapes_dirty = true;
     }
-    void draw_knob(gfx::canvas& dst, spoint16 loc) {
-        float radius;
+    float knob_radius() const {
+        if (m_orientation == uix_orientation::horizontal) {
+            return this->bounds().height() * 0.5f;
+        }
+        return this->bounds().width() * 0.5f;
+    }
+    spoint16 knob_location() const {
         if (m_orientation == uix_orientation::horizontal) {
-            radius = this->bounds().height() * 0.5f;
+            float radiusx2 = this->bounds().height();
+            return spoint16(value() * (this->dimensions().width - radiusx2), 0);
+        }
+        float radiusx2 = this->bounds().width();
+        return spoint16(0, (!value()) * (this->dimensions().height - radiusx2));
+    }
+    // the knob relative to its location. an ellipse is a rectangle rounded by half its size
+    rectf knob_rect(sizef* out_radiuses) const {
+        const float radius = knob_radius();
+        const rectf r(pointf(radius, radius), radius * 0.7f);
+        if (m_knob_shape == vswitch_shape::circle) {
+            *out_radiuses = sizef(radius * 0.7f, radius * 0.7f);
         } else {
-            radius = this->bounds().width() * 0.5f;
+            *out_radiuses = (sizef)m_knob_radiuses;
         }
-        gfx::canvas_style si=dst.style();
-        si.fill_paint_type = gfx::paint_type::solid;
-        si.fill_color = m_knob_color;
-        si.stroke_width = m_knob_border_width;
-        si.stroke_paint_type = gfx::paint_type::solid;
-        si.stroke_color = m_knob_border_color;
-        dst.style(si);
+        return r;
+    }
+    // the pixels the knob touches, including its border and anti-aliasing
+    srect16 knob_bounds() const {
+        sizef radiuses;
+        const rectf r = knob_rect(&radiuses);
+        const spoint16 loc = knob_location();
+        const float pad = m_knob_border_width * .5f + 1.f;
+        return srect16(loc.x + floorf(r.x1 - pad), loc.y + floorf(r.y1 - pad), loc.x + ceilf(r.x2 + pad), loc.y + ceilf(r.y2 + pad));
+    }
+    void knob_path(gfx::canvas& dst, spoint16 loc) {
+        const float radius = knob_radius();
         if(m_knob_shape==vswitch_shape::circle) {
             pointf center(radius, radius);
             dst.ellipse(center.offset(loc.x,loc.y), {radius*0.7f, radius*0.7f});
@@ -76,35 +103,66 @@ class vswitch : public canvas_control<ControlSurfaceType> {
                 dst.rounded_rectangle(r,(sizef)m_knob_radiuses);
             }
         }
-        dst.render();
-    
     }
-    void draw_backing(gfx::canvas& dst) {
-        rectf bounds;
-        if (m_orientation == uix_orientation::horizontal) {
-            bounds = rectf(0, 0, this->dimensions().width - 1 ,this->dimensions().height - 1);
-        } else {
-            bounds = rectf(0, 0, this->dimensions().width - 1, this->dimensions().height - 1);
-        }
+    void draw_knob(gfx::canvas& dst, spoint16 loc) {
         gfx::canvas_style si=dst.style();
         si.fill_paint_type = gfx::paint_type::solid;
-        si.fill_color = m_background_color;
-        si.stroke_width = m_border_width;
+        si.fill_color = m_knob_color;
+        si.stroke_width = m_knob_border_width;
         si.stroke_paint_type = gfx::paint_type::solid;
-        si.stroke_color = m_border_color;
+        si.stroke_color = m_knob_border_color;
         dst.style(si);
+        knob_path(dst, loc);
+        dst.render();
+    
+    }
+    rectf backing_rect() const {
+        rectf bounds(0, 0, this->dimensions().width - 1, this->dimensions().height - 1);
         bounds.x1+=1.0f;
         bounds.y1+=1.0f;
         bounds.x2-=1.0f;
         bounds.y2-=1.0f;
+        return bounds;
+    }
+    void backing_path(gfx::canvas& dst) {
+        const rectf bounds = backing_rect();
         if (m_radiuses.width != 0 || m_radiuses.height != 0) {
             dst.rounded_rectangle(bounds, (sizef)m_radiuses);
         } else {
             dst.rectangle(bounds);
         }
+    }
+    void draw_backing(gfx::canvas& dst) {
+        gfx::canvas_style si=dst.style();
+        si.fill_paint_type = gfx::paint_type::solid;
+        si.fill_color = m_background_color;
+        si.stroke_width = m_border_width;
+        si.stroke_paint_type = gfx::paint_type::solid;
+        si.stroke_color = m_border_color;
+        dst.style(si);
+        backing_path(dst);
         dst.render();
     
     }
+    void build_shapes() {
+        m_shapes_dirty = false;
+        clear_shapes();
+        const rectf backing = backing_rect();
+        sizef knob_radiuses;
+        const rectf knob = knob_rect(&knob_radiuses);
+        if (uix_result::success != m_backing_fill.fill(backing, (sizef)m_radiuses) ||
+            uix_result::success != m_knob_fill.fill(knob, knob_radiuses) ||
+            (m_border_width > 0 && uix_result::success != m_backing_border.stroke(backing, (sizef)m_radiuses, m_border_width)) ||
+            (m_knob_border_width > 0 && uix_result::success != m_knob_border.stroke(knob, knob_radiuses, m_knob_border_width))) {
+            clear_shapes();
+        }
+    }
+    void clear_shapes() {
+        m_backing_fill.clear();
+        m_backing_border.clear();
+        m_knob_fill.clear();
+        m_knob_border.clear();
+    }
 
    protected:
     /// @brief For derivative classes, moves the control
@@ -149,14 +207,14 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @brief Constructs a slider from a given parent with an optional palette
     /// @param parent The parent the control is bound to - usually the screen
     /// @param palette The palette associated with the control. This is usually the screen's palette.
-    vswitch(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_knob_border_width(1),m_knob_shape(vswitch_shape::circle), m_knob_radiuses(2,2), m_border_width(1), m_radiuses(2, 2), m_value(false), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr) {
+    vswitch(invalidation_tracker& parent, const palette_type* palette = nullptr) : base_type(parent, palette), m_knob_border_width(1),m_knob_shape(vswitch_shape::circle), m_knob_radiuses(2,2), m_border_width(1), m_radiuses(2, 2), m_value(false), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_shapes_dirty(true) {
         m_knob_color = gfx::vector_pixel(255, 255, 255, 255);
         m_knob_border_color = gfx::vector_pixel(255, 0, 0, 0);
         m_background_color = gfx::vector_pixel(255, 255, 255, 255);
         m_border_color = gfx::vector_pixel(255,0, 0, 0);
     }
     /// @brief Constructs a slider from a given parent with an optional palette
-    vswitch() : base_type(), m_knob_border_width(1),m_knob_shape(vswitch_shape::circle), m_knob_radiuses(2,2), m_border_width(1), m_radiuses(2, 2), m_value(false), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr) {
+    vswitch() : base_type(), m_knob_border_width(1),m_knob_shape(vswitch_shape::circle), m_knob_radiuses(2,2), m_border_width(1), m_radiuses(2, 2), m_value(false), m_on_value_changed_cb(nullptr), m_on_value_changed_state(nullptr), m_shapes_dirty(true) {
         m_knob_color = gfx::vector_pixel(255, 255, 255, 255);
         m_knob_border_color = gfx::vector_pixel(255, 0, 0, 0);
         m_background_color = gfx::vector_pixel(255, 255, 255, 255);
@@ -197,6 +255,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void knob_border_width(uint16_t value) {
         m_knob_border_width = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the shape of the knob
@@ -208,6 +267,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The shape
     void knob_shape(vswitch_shape value) {
         m_knob_shape = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the radiuses of the knob
@@ -219,6 +279,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The knob radiuses
     void knob_radiuses(size16 value) {
         m_knob_radiuses = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the color of the switch background
@@ -256,6 +317,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The width in pixels
     void border_width(uint16_t value) {
         m_border_width = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     
@@ -268,6 +330,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The bar radiuses
     void radiuses(size16 value) {
         m_radiuses = value;
+        m_shapes_dirty = true;
         this->invalidate();
     }
     /// @brief Indicates the orientation of the slider
@@ -280,6 +343,7 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     void orientation(uix_orientation value) {
         if (m_orientation != value) {
             m_orientation = value;
+            m_shapes_dirty = true;
             this->invalidate();
         }
     }
@@ -292,11 +356,13 @@ class vswitch : public canvas_control<ControlSurfaceType> {
     /// @param value The value
     void value(bool value) {
         if (m_value != value) {
+            // only the knob moves, so only where it was and where it is now need redrawing
+            const srect16 old_knob = knob_bounds();
             m_value = value;
             if (m_on_value_changed_cb != nullptr) {
                 m_on_value_changed_cb(m_value,m_on_value_changed_state);
             }
-            this->invalidate();
+            this->invalidate(old_knob, knob_bounds());
         }
     }
     /// @brief Indicates the callback for when the value changes
@@ -313,21 +379,37 @@ class vswitch : public canvas_control<ControlSurfaceType> {
         m_on_value_changed_state = state;
     }
     
+    /// @brief Called when the control is resized
+    virtual void on_after_resize() override {
+        m_shapes_dirty = true;
+    }
+    /// @brief Called before the control is rendered
+    virtual void on_before_paint() override {
+        if (m_shapes_dirty) {
+            build_shapes();
+        }
+    }
+    /// @brief Called when the slider is painted
+    /// @param destination The draw destination
+    /// @param clip The clipping rectangle
+    virtual void on_paint(control_surface_type& destination, const srect16& clip) override {
+        if (!m_backing_fill.valid() || !m_knob_fill.valid()) {
+            // rasterize through the canvas
+            base_type::on_paint(destination, clip);
+            return;
+        }
+        m_backing_fill.paint(destination, spoint16::zero(), m_background_color, clip);
+        m_backing_border.paint(destination, spoint16::zero(), m_border_color, clip);
+        const spoint16 pt = knob_location();
+        m_knob_fill.paint(destination, pt, m_knob_color, clip);
+        m_knob_border.paint(destination, pt, m_knob_border_color, clip);
+    }
     /// @brief Called when the slider is painted
     /// @param destination The draw destination
     /// @param clip The clipping rectangle
     virtual void on_paint(gfx::canvas& destination, const srect16& clip) override {
         draw_backing(destination);
-        
-        if (m_orientation == uix_orientation::horizontal) {
-            float radiusx2 = this->bounds().height();
-            spoint16 pt(value() *(this->dimensions().width-radiusx2), 0);
-            draw_knob(destination,pt);
-        } else {
-            float radiusx2 = this->bounds().width();
-            spoint16 pt(0,(!value()) * (this->dimensions().height - radiusx2));
-            draw_knob(destination,pt);
-        }
+        draw_knob(destination, knob_location());
     }
     /// @brief Called when the slider is touched
     /// @param locations_size The count of locations (only the first one is respected)
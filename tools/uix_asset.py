@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""Converts PNG/JPEG images into UIX native assets.
+
+A native asset holds pixels already in a gfx pixel format, so an
+asset_box<> can copy them straight to the display with no decoding.
+The output is either a C header holding a const array, or a raw binary
+suitable for a memory mapped flash partition.
+
+    uix_asset.py icon.png                      -> icon.h, RGB565
+    uix_asset.py photo.jpg -f rgb -b 24        -> photo.h, RGB888
+    uix_asset.py logo.png -f gray -b 4 --binary -o logo.bin
+    uix_asset.py button.png --rle              -> button.h, RLE, 16 colors
+
+Run length encoded assets hold a palette of up to 16 (4-bit indices) or
+256 (8-bit indices) pixels and rows of packets indexing into it. Images
+with more colors than that are quantized first.
+
+Requires Pillow (pip install pillow).
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    sys.exit("uix_asset.py requires Pillow: pip install pillow")
+
+MAGIC = b"UIXA"
+VERSION = 1
+HEADER_SIZE = 16
+
+# must match uix::asset_format
+FORMATS = {"rgb": 0, "gray": 1, "rgba": 2, "alpha": 3}
+# must match uix::asset_compression
+COMPRESSION_NONE = 0
+COMPRESSION_RLE = 1
+# the longest run or literal a packet can hold
+MAX_PACKET = 128
+
+# the bit depths each format supports
+DEPTHS = {
+    "rgb": (16, 24),
+    "gray": (1, 2, 4, 8),
+    "rgba": (32,),
+    "alpha": (1, 2, 4, 8),
+}
+
+
+def header(fmt, depth, compression, width, height, stride):
+    return MAGIC + struct.pack("<BBBBHHI", VERSION, FORMATS[fmt], depth, compression, width, height, stride)
+
+
+def pack_row(values, depth):
+    """Packs one row of pixel values the way gfx bitmaps hold them: big endian,
+    with sub-byte pixels filling each byte from its most significant bit."""
+    if depth % 8 == 0:
+        size = depth // 8
+        out = bytearray()
+        for v in values:
+            out += v.to_bytes(size, "big")
+        return bytes(out)
+    out = bytearray((len(values) * depth + 7) // 8)
+    for i, v in enumerate(values):
+        bit = i * depth
+        out[bit // 8] |= v << (8 - depth - (bit % 8))
+    return bytes(out)
+
+
+def pixel_values(img, fmt, depth):
+    """Yields each row of the image as a list of pixel values in the target format."""
+    w, h = img.size
+    if fmt == "rgb":
+        px = img.convert("RGB").load()
+        for y in range(h):
+            row = []
+            for x in range(w):
+                r, g, b = px[x, y]
+                if depth == 16:
+                    row.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+                else:
+                    row.append((r << 16) | (g << 8) | b)
+            yield row
+    elif fmt == "rgba":
+        px = img.convert("RGBA").load()
+        for y in range(h):
+            yield [(r << 24) | (g << 16) | (b << 8) | a for r, g, b, a in (px[x, y] for x in range(w))]
+    else:
+        if fmt == "gray":
+            band = img.convert("L")
+        else:
+            band = img.convert("RGBA").getchannel("A")
+        px = band.load()
+        shift = 8 - depth
+        for y in range(h):
+            yield [px[x, y] >> shift for x in range(w)]
+
+
+def convert(img, fmt, depth):
+    w, h = img.size
+    stride = (w * depth + 7) // 8
+    data = bytearray(header(fmt, depth, COMPRESSION_NONE, w, h, stride))
+    for row in pixel_values(img, fmt, depth):
+        data += pack_row(row, depth)
+    return bytes(data)
+
+
+def quantize(img, fmt, colors):
+    if fmt == "rgb":
+        return img.convert("RGB").quantize(colors).convert("RGB")
+    if fmt == "rgba":
+        return img.convert("RGBA").quantize(colors, method=Image.FASTOCTREE).convert("RGBA")
+    return None
+
+
+def encode_row(indices, index_bits):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            if index_bits == 8:
+                out.extend(literal)
+            else:
+                padded = literal + [0] * (len(literal) & 1)
+                out.extend((padded[i] << 4) | padded[i + 1] for i in range(0, len(padded), 2))
+            del literal[:]
+
+    i = 0
+    while i < len(indices):
+        n = 1
+        while i + n < len(indices) and n < MAX_PACKET and indices[i + n] == indices[i]:
+            n += 1
+        if n >= 3:
+            flush()
+            out.append(0x80 | (n - 1))
+            out.append(indices[i])
+            i += n
+        else:
+            literal.append(indices[i])
+            if len(literal) == MAX_PACKET:
+                flush()
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def convert_rle(img, fmt, depth, index_bits):
+    limit = 1 << index_bits
+    rows = list(pixel_values(img, fmt, depth))
+    colors = sorted(set(v for row in rows for v in row))
+    if len(colors) > limit:
+        reduced = quantize(img, fmt, limit)
+        if reduced is None:
+            sys.exit("%d levels don't fit in %d-bit indices. Use 8-bit indices or a lower bit depth" % (len(colors), index_bits))
+        rows = list(pixel_values(reduced, fmt, depth))
+        colors = sorted(set(v for row in rows for v in row))
+        if len(colors) > limit:
+            sys.exit("%d colors remain after quantizing, which don't fit in %d-bit indices" % (len(colors), index_bits))
+    lookup = {v: i for i, v in enumerate(colors)}
+    w, h = img.size
+    data = bytearray(header(fmt, depth, COMPRESSION_RLE, w, h, 0))
+    data += struct.pack("<BBH", index_bits, 0, len(colors))
+    entry_size = (depth + 7) // 8
+    for v in colors:
+        data += v.to_bytes(entry_size, "big")
+    encoded = [encode_row([lookup[v] for v in row], index_bits) for row in rows]
+    offset = 0
+    for row in encoded:
+        data += struct.pack("<I", offset)
+        offset += len(row)
+    for row in encoded:
+        data += row
+    return bytes(data)
+
+
+def c_identifier(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    name = re.sub(r"[^0-9a-zA-Z_]", "_", name)
+    if name[:1].isdigit():
+        name = "_" + name
+    return name
+
+
+def write_header(path, name, data):
+    guard = name.upper() + "_HPP"
+    impl = name.upper() + "_IMPLEMENTATION"
+    with open(path, "w") as f:
+        f.write("// Generated by uix_asset.py\n")
+        f.write("// --------------------------------------------------------\n")
+        f.write("// Add #define %s\n" % impl)
+        f.write("// to exactly one CPP file before including this file.\n")
+        f.write("// --------------------------------------------------------\n\n")
+        f.write("#ifndef %s\n#define %s\n#include <stdint.h>\n" % (guard, guard))
+        f.write("extern const uint8_t %s[];\n#endif\n\n" % name)
+        f.write("#ifdef %s\n\nconst uint8_t %s[] = {\n" % (impl, name))
+        for i in range(0, len(data), 16):
+            f.write("\t" + ",".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n#endif\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts PNG/JPEG images into UIX native assets")
+    parser.add_argument("input", help="the image to convert")
+    parser.add_argument("-o", "--output", help="the output file (defaults to the input name with .h or .bin)")
+    parser.add_argument("-n", "--name", help="the C array name (defaults to the input name)")
+    parser.add_argument("-f", "--format", choices=sorted(FORMATS), default="rgb", help="the color model (default rgb)")
+    parser.add_argument("-b", "--bits", type=int, help="the bit depth (default 16 for rgb, 8 for gray and alpha, 32 for rgba)")
+    parser.add_argument("--rle", action="store_true", help="run length encode palette indices")
+    parser.add_argument("-i", "--index-bits", type=int, choices=(4, 8), default=4, help="the bit depth of a palette index when run length encoding (default 4)")
+    parser.add_argument("--binary", action="store_true", help="write the raw asset instead of a C header")
+    args = parser.parse_args()
+
+    depth = args.bits if args.bits is not None else DEPTHS[args.format][-1 if args.format != "rgb" else 0]
+    if depth not in DEPTHS[args.format]:
+        parser.error("%s supports bit depths %s" % (args.format, ", ".join(str(d) for d in DEPTHS[args.format])))
+
+    img = Image.open(args.input)
+    if args.rle:
+        data = convert_rle(img, args.format, depth, args.index_bits)
+    else:
+        data = convert(img, args.format, depth)
+    name = args.name or c_identifier(args.input)
+    output = args.output or os.path.splitext(args.input)[0] + (".bin" if args.binary else ".h")
+    if args.binary:
+        with open(output, "wb") as f:
+            f.write(data)
+    else:
+        write_header(output, name, data)
+    print("%s: %dx%d %s%d%s, %d bytes" % (output, img.size[0], img.size[1], args.format, depth, ", rle" if args.rle else "", len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""Bakes static text and shapes into UIX native assets at build time.
+
+Text and button chrome that never change don't need to be rasterized on
+the device. This renders them ahead of time from a JSON description and
+writes every result to one C header, for asset_box<> to copy at runtime.
+
+    uix_bake.py ui.json                        -> ui.h
+    uix_bake.py ui.json -o include/assets/baked_ui.h
+
+The description holds a list of items:
+
+    {
+        "items": [
+            {"name": "title", "type": "text", "text": "Settings",
+             "font": "fonts/OpenSans-Regular.ttf", "size": 24,
+             "width": 200, "height": 32, "justify": "center"},
+            {"name": "ok_chrome", "type": "rectangle",
+             "width": 120, "height": 40, "radius": 8, "border": 2},
+            {"name": "ok_button", "type": "button", "format": "rgb", "bits": 16,
+             "text": "OK", "font": "fonts/OpenSans-Regular.ttf", "size": 18,
+             "width": 120, "height": 40, "radius": 8, "border": 2,
+             "color": "#FFFFFF", "fill": "#0040A0", "border_color": "#80C0FF",
+             "background": "#000000"}
+        ]
+    }
+
+Items default to 8-bit alpha ("format": "alpha"), which asset_box<> paints
+in whatever color() it is given, so one asset serves every color scheme.
+Any other format bakes the colors in, and may be run length encoded with
+"rle": true. Sizes are in pixels, "size" is the font height, and
+"justify" is one of the uix_justify names (top_left, center, ...).
+
+Requires Pillow (pip install pillow).
+"""
+import argparse
+import json
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import uix_asset  # noqa: E402
+
+from PIL import Image, ImageDraw, ImageFont  # noqa: E402
+
+# shapes are drawn this many times larger and reduced, to anti-alias them
+SUPERSAMPLE = 4
+
+
+def parse_color(value, default):
+    if value is None:
+        value = default
+    value = value.lstrip("#")
+    if len(value) == 6:
+        value += "FF"
+    return tuple(int(value[i:i + 2], 16) for i in range(0, 8, 2))
+
+
+def text_layer(item, size):
+    """Renders the text of an item as 8-bit coverage, justified within size."""
+    layer = Image.new("L", size, 0)
+    if not item.get("text"):
+        return layer
+    font = ImageFont.truetype(item["font"], item["size"])
+    draw = ImageDraw.Draw(layer)
+    x1, y1, x2, y2 = draw.textbbox((0, 0), item["text"], font=font)
+    justify = item.get("justify", "center")
+    w, h = size
+    if justify.endswith("left"):
+        x = 0
+    elif justify.endswith("right"):
+        x = w - (x2 - x1)
+    else:
+        x = (w - (x2 - x1)) // 2
+    if justify.startswith("top"):
+        y = 0
+    elif justify.startswith("bottom"):
+        y = h - (y2 - y1)
+    else:
+        y = (h - (y2 - y1)) // 2
+    draw.text((x - x1, y - y1), item["text"], font=font, fill=255)
+    return layer
+
+
+def shape_layers(item, size):
+    """Renders the fill and border of a rounded rectangle as 8-bit coverage."""
+    w, h = size
+    s = SUPERSAMPLE
+    radius = item.get("radius", 0) * s
+    border = item.get("border", 0) * s
+    fill = Image.new("L", (w * s, h * s), 0)
+    ImageDraw.Draw(fill).rounded_rectangle((0, 0, w * s - 1, h * s - 1), radius, fill=255)
+    outline = Image.new("L", (w * s, h * s), 0)
+    if border > 0:
+        ImageDraw.Draw(outline).rounded_rectangle((0, 0, w * s - 1, h * s - 1), radius, outline=255, width=border)
+    return fill.resize(size, Image.LANCZOS), outline.resize(size, Image.LANCZOS)
+
+
+def coverage(item):
+    """The item as a single 8-bit coverage layer, for alpha assets."""
+    size = (item["width"], item["height"])
+    kind = item["type"]
+    if kind == "text":
+        return text_layer(item, size)
+    fill, outline = shape_layers(item, size)
+    if kind == "rectangle":
+        # in one color a bordered face is just a face, so a border means an outline
+        return outline if item.get("border", 0) > 0 else fill
+    # a button's text is cut out of its face
+    text = text_layer(item, size)
+    return Image.composite(Image.new("L", size, 0), fill, text)
+
+
+def colored(item):
+    """The item composited in its colors, for native assets."""
+    size = (item["width"], item["height"])
+    kind = item["type"]
+    img = Image.new("RGBA", size, parse_color(item.get("background"), "#00000000"))
+    if kind in ("rectangle", "button"):
+        fill, outline = shape_layers(item, size)
+        img.paste(Image.new("RGBA", size, parse_color(item.get("fill"), "#404040")), (0, 0), fill)
+        if item.get("border", 0) > 0:
+            img.paste(Image.new("RGBA", size, parse_color(item.get("border_color"), "#FFFFFF")), (0, 0), outline)
+    if kind in ("text", "button"):
+        img.paste(Image.new("RGBA", size, parse_color(item.get("color"), "#FFFFFF")), (0, 0), text_layer(item, size))
+    return img
+
+
+def bake(item):
+    fmt = item.get("format", "alpha")
+    if fmt not in uix_asset.FORMATS:
+        sys.exit("%s: unknown format %s" % (item["name"], fmt))
+    default_depth = 16 if fmt == "rgb" else uix_asset.DEPTHS[fmt][-1]
+    depth = item.get("bits", default_depth)
+    if depth not in uix_asset.DEPTHS[fmt]:
+        sys.exit("%s: %s supports bit depths %s" % (item["name"], fmt, ", ".join(str(d) for d in uix_asset.DEPTHS[fmt])))
+    if fmt == "alpha":
+        img = Image.new("RGBA", (item["width"], item["height"]), (255, 255, 255, 0))
+        img.putalpha(coverage(item))
+    else:
+        img = colored(item)
+    if item.get("rle", False):
+        if fmt == "alpha":
+            sys.exit("%s: alpha assets can't be run length encoded" % item["name"])
+        return uix_asset.convert_rle(img, fmt, depth, item.get("index_bits", 4))
+    return uix_asset.convert(img, fmt, depth)
+
+
+def write_header(path, assets):
+    base = uix_asset.c_identifier(path)
+    guard = base.upper() + "_HPP"
+    impl = base.upper() + "_IMPLEMENTATION"
+    with open(path, "w") as f:
+        f.write("// Generated by uix_bake.py\n")
+        f.write("// --------------------------------------------------------\n")
+        f.write("// Add #define %s\n" % impl)
+        f.write("// to exactly one CPP file before including this file.\n")
+        f.write("// --------------------------------------------------------\n\n")
+        f.write("#ifndef %s\n#define %s\n#include <stdint.h>\n" % (guard, guard))
+        for name, _ in assets:
+            f.write("extern const uint8_t %s[];\n" % name)
+        f.write("#endif\n\n#ifdef %s\n" % impl)
+        for name, data in assets:
+            f.write("\nconst uint8_t %s[] = {\n" % name)
+            for i in range(0, len(data), 16):
+                f.write("\t" + ",".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+            f.write("};\n")
+        f.write("#endif\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bakes static text and shapes into UIX native assets")
+    parser.add_argument("input", help="the JSON description of the items to bake")
+    parser.add_argument("-o", "--output", help="the output header (defaults to the input name with .h)")
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        desc = json.load(f)
+    base = os.path.dirname(os.path.abspath(args.input))
+    assets = []
+    for item in desc.get("items", []):
+        if item.get("type") not in ("text", "rectangle", "button"):
+            sys.exit("%s: type must be text, rectangle or button" % item.get("name"))
+        if "font" in item and not os.path.isabs(item["font"]):
+            item["font"] = os.path.join(base, item["font"])
+        name = re.sub(r"[^0-9a-zA-Z_]", "_", item["name"])
+        data = bake(item)
+        assets.append((name, data))
+        print("%s: %dx%d %s, %d bytes" % (name, item["width"], item["height"], item.get("format", "alpha"), len(data)))
+    output = args.output or os.path.splitext(args.input)[0] + ".h"
+    write_header(output, assets)
+
+
+if __name__ == "__main__":
+    main()